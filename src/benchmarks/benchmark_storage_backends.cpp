@@ -0,0 +1,85 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+#include "vecs/ECS.h"
+#include "vecs/Archetype.h"
+
+namespace {
+    struct alignas(16) Position {
+        float x{}, y{}, z{};
+        float padding{};
+    };
+
+    struct alignas(16) Velocity {
+        float dx{}, dy{}, dz{};
+        float padding{};
+    };
+
+    struct Health {
+        int value{};
+    };
+
+    // Every other entity has a Velocity and every third a Health, spreading the world over four archetypes
+    template<typename World>
+    void setupWorld(World& world, const size_t entityCount) {
+        world.clear();
+        for (size_t i = 0; i < entityCount; ++i) {
+            const auto entity = world.createEntity();
+            world.template emplaceComponent<Position>(entity, static_cast<float>(i), 0.0f, 0.0f);
+            if (i % 2 == 0) {
+                world.template emplaceComponent<Velocity>(entity, 1.0f, 2.0f, 3.0f);
+            }
+            if (i % 3 == 0) {
+                world.template emplaceComponent<Health>(entity, 100);
+            }
+        }
+    }
+
+    template<typename World>
+    void BM_BackendIterate(benchmark::State& state) {
+        World world;
+        setupWorld(world, static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            auto view = world.template view<Position, Velocity>();
+            float accumulator = 0.0f;
+            view.each([&accumulator](const Position& pos, const Velocity& vel) {
+                accumulator += pos.x * vel.dx + pos.y * vel.dy + pos.z * vel.dz;
+            });
+            benchmark::DoNotOptimize(accumulator);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+    }
+
+    template<typename World>
+    void BM_BackendAddRemove(benchmark::State& state) {
+        World world;
+        setupWorld(world, static_cast<size_t>(state.range(0)));
+
+        std::vector<vecs::Entity> entities;
+        world.template view<Position>().each([&entities](const vecs::Entity entity) {
+            entities.push_back(entity);
+        });
+
+        for (auto _ : state) {
+            for (const auto entity : entities) {
+                world.template removeComponent<Position>(entity);
+            }
+            for (const auto entity : entities) {
+                world.template emplaceComponent<Position>(entity, 1.0f, 0.0f, 0.0f);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+    }
+}
+
+BENCHMARK(BM_BackendIterate<vecs::ECS>)->Name("BM_BackendIterate/SparseSet")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BackendIterate<vecs::ArchetypeECS>)->Name("BM_BackendIterate/Archetype")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BackendAddRemove<vecs::ECS>)->Name("BM_BackendAddRemove/SparseSet")
+    ->RangeMultiplier(10)->Range(10'000, 100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BackendAddRemove<vecs::ArchetypeECS>)->Name("BM_BackendAddRemove/Archetype")
+    ->RangeMultiplier(10)->Range(10'000, 100'000)->Unit(benchmark::kMicrosecond);
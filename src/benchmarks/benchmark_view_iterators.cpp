@@ -0,0 +1,95 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include "vecs/ECS.h"
+#include "vecs/View.h"
+
+namespace {
+    struct alignas(16) Position {
+        float x{}, y{}, z{};
+        float padding{};
+    };
+
+    struct alignas(16) Velocity {
+        float dx{}, dy{}, dz{};
+        float padding{};
+    };
+
+    // Every other entity also carries a Velocity so the join has to skip candidates
+    void setupWorld(vecs::ECS& ecs, const size_t entityCount) {
+        ecs.clear();
+        for (size_t i = 0; i < entityCount; ++i) {
+            const auto entity = ecs.createEntity();
+            ecs.emplaceComponent<Position>(entity,
+                static_cast<float>(i),
+                static_cast<float>(i * 2),
+                static_cast<float>(i * 3)
+            );
+            if (i % 2 == 0) {
+                ecs.emplaceComponent<Velocity>(entity, 1.0f, 2.0f, 3.0f);
+            }
+        }
+    }
+
+    void BM_ViewEach(benchmark::State& state) {
+        vecs::ECS ecs;
+        setupWorld(ecs, static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            const auto view = ecs.view<Position, Velocity>();
+            float accumulator = 0.0f;
+
+            view.each([&accumulator](const Position& pos, const Velocity& vel) {
+                accumulator += pos.x * vel.dx + pos.y * vel.dy + pos.z * vel.dz;
+            });
+
+            benchmark::DoNotOptimize(accumulator);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_ViewRangeFor(benchmark::State& state) {
+        vecs::ECS ecs;
+        setupWorld(ecs, static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            const auto view = ecs.view<Position, Velocity>();
+            float accumulator = 0.0f;
+
+            for (const auto entity : view) {
+                const auto& pos = view.get<Position>(entity);
+                const auto& vel = view.get<Velocity>(entity);
+                accumulator += pos.x * vel.dx + pos.y * vel.dy + pos.z * vel.dz;
+            }
+
+            benchmark::DoNotOptimize(accumulator);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_ViewForEachAlgorithm(benchmark::State& state) {
+        vecs::ECS ecs;
+        setupWorld(ecs, static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            const auto view = ecs.view<Position, Velocity>();
+            float accumulator = 0.0f;
+
+            std::for_each(view.begin(), view.end(), [&view, &accumulator](const vecs::Entity entity) {
+                const auto& pos = view.get<Position>(entity);
+                const auto& vel = view.get<Velocity>(entity);
+                accumulator += pos.x * vel.dx + pos.y * vel.dy + pos.z * vel.dz;
+            });
+
+            benchmark::DoNotOptimize(accumulator);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_ViewEach)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ViewRangeFor)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ViewForEachAlgorithm)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,79 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <benchmark/benchmark.h>
+#include "vecs/ECS.h"
+#include "vecs/View.h"
+
+namespace {
+    struct alignas(16) Position {
+        float x{}, y{}, z{};
+        float padding{};
+    };
+
+    struct alignas(16) Velocity {
+        float dx{}, dy{}, dz{};
+        float padding{};
+    };
+
+    /**
+     * Components are added in two independent random orders, so the dense arrays of both
+     * pools are shuffled relative to each other and to the entity IDs, and every probe of
+     * the joined view lands on an unrelated cache line.
+     */
+    vecs::ECS& interleavedWorld(const size_t entityCount) {
+        static std::map<size_t, std::unique_ptr<vecs::ECS>> worlds;
+        if (const auto it = worlds.find(entityCount); it != worlds.end()) {
+            return *it->second;
+        }
+
+        auto ecs = std::make_unique<vecs::ECS>(entityCount);
+        std::vector<vecs::Entity> entities(entityCount);
+        for (auto& entity : entities) {
+            entity = ecs->createEntity();
+        }
+
+        std::mt19937 random{42};
+        std::ranges::shuffle(entities, random);
+        for (size_t i = 0; i < entityCount; ++i) {
+            ecs->emplaceComponent<Position>(entities[i], static_cast<float>(i), 0.0f, 0.0f);
+        }
+
+        std::ranges::shuffle(entities, random);
+        for (size_t i = 0; i < entityCount / 2; ++i) {
+            ecs->emplaceComponent<Velocity>(entities[i], 1.0f, 2.0f, 3.0f);
+        }
+
+        return *worlds.emplace(entityCount, std::move(ecs)).first->second;
+    }
+
+    // range(0): entity count, range(1): prefetch distance, -1 selects the automatic distance
+    void BM_JoinedViewPrefetch(benchmark::State& state) {
+        auto& ecs = interleavedWorld(static_cast<size_t>(state.range(0)));
+        const auto distance = state.range(1) < 0
+            ? vecs::View<Position, Velocity>::autoPrefetch
+            : static_cast<size_t>(state.range(1));
+        const auto view = ecs.view<Position, Velocity>().withPrefetchDistance(distance);
+
+        for (auto _ : state) {
+            float accumulator = 0.0f;
+            view.each([&accumulator](const Position& pos, const Velocity& vel) {
+                accumulator += pos.x * vel.dx + pos.y * vel.dy + pos.z * vel.dz;
+            });
+            benchmark::DoNotOptimize(accumulator);
+        }
+
+        state.counters["Distance"] = static_cast<double>(view.getPrefetchDistance());
+        state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+    }
+}
+
+BENCHMARK(BM_JoinedViewPrefetch)
+    ->ArgsProduct({{1'000'000, 10'000'000}, {0, 4, 8, 16, 32, -1}})
+    ->ArgNames({"entities", "distance"})
+    ->Unit(benchmark::kMillisecond);
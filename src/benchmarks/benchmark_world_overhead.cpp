@@ -0,0 +1,46 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <utility>
+#include "vecs/ECS.h"
+
+namespace {
+    // Forty distinct component types, as in a full game world
+    template<size_t N>
+    struct Component {
+        float value{};
+    };
+
+    constexpr size_t componentTypes = 40;
+
+    template<size_t... Ns>
+    void populate(vecs::ECS& world, const size_t entityCount, std::index_sequence<Ns...>) {
+        for (size_t i = 0; i < entityCount; ++i) {
+            const auto entity = world.createEntity();
+            (world.emplaceComponent<Component<Ns>>(entity, static_cast<float>(i)), ...);
+        }
+    }
+
+    // Builds and tears down a small per-match world, reporting the bytes it held
+    void BM_WorldLifetime(benchmark::State& state, const vecs::WorldConfig config) {
+        const auto entityCount = static_cast<size_t>(state.range(0));
+        size_t bytes = 0;
+
+        for (auto _ : state) {
+            vecs::ECS world{config};
+            populate(world, entityCount, std::make_index_sequence<componentTypes>{});
+            bytes = world.memoryStats().totalBytes();
+            benchmark::DoNotOptimize(world);
+        }
+
+        state.counters["BytesPerWorld"] = static_cast<double>(bytes);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_WorldLifetime, Default, vecs::WorldConfig{})
+    ->Arg(16)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_WorldLifetime, Minimal, vecs::WorldConfig::minimal())
+    ->Arg(16)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,487 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef ARCHETYPE_H
+#define ARCHETYPE_H
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include "Entity.h"
+
+namespace vecs {
+    /**
+     * @brief Type-erased column of an archetype table
+     *
+     * Virtual calls only happen when entities change archetype; iteration reads the
+     * typed vector directly.
+     */
+    class ArchetypeColumn {
+    public:
+        virtual ~ArchetypeColumn() = default;
+
+        /**
+         * @brief Appends the value of a row to a column of the same type
+         */
+        virtual void moveRowTo(size_t row, ArchetypeColumn& target) = 0;
+        virtual void swapRemove(size_t row) noexcept = 0;
+        virtual void reserve(size_t capacity) = 0;
+        /**
+         * @brief Drops every row from index size on
+         */
+        virtual void truncate(size_t size) noexcept = 0;
+        virtual void clear() noexcept = 0;
+        [[nodiscard]] virtual std::unique_ptr<ArchetypeColumn> cloneEmpty() const = 0;
+    };
+
+    template<typename T>
+    class TypedColumn final : public ArchetypeColumn {
+        std::vector<T> values;
+
+    public:
+        void moveRowTo(const size_t row, ArchetypeColumn& target) override {
+            static_cast<TypedColumn&>(target).values.push_back(std::move(values[row]));
+        }
+
+        void swapRemove(const size_t row) noexcept override {
+            if (row + 1 != values.size()) {
+                values[row] = std::move(values.back());
+            }
+            values.pop_back();
+        }
+
+        void reserve(const size_t capacity) override { values.reserve(capacity); }
+
+        void truncate(const size_t size) noexcept override {
+            values.erase(values.begin() + static_cast<std::ptrdiff_t>(size), values.end());
+        }
+
+        void clear() noexcept override { values.clear(); }
+
+        [[nodiscard]] std::unique_ptr<ArchetypeColumn> cloneEmpty() const override {
+            return std::make_unique<TypedColumn>();
+        }
+
+        [[nodiscard]] std::vector<T>& getValues() noexcept { return values; }
+        [[nodiscard]] const std::vector<T>& getValues() const noexcept { return values; }
+    };
+
+    /**
+     * @brief Table of all entities sharing exactly the same set of component types
+     *
+     * Rows are kept dense with swap-and-pop, so every column is a contiguous array
+     * indexed by the same row as the entity list.
+     */
+    class Archetype {
+        std::vector<std::type_index> types;
+        std::vector<std::unique_ptr<ArchetypeColumn>> columns;
+        std::vector<Entity> entities;
+
+    public:
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+        Archetype(std::vector<std::type_index> signature, std::vector<std::unique_ptr<ArchetypeColumn>> tableColumns)
+            : types(std::move(signature)), columns(std::move(tableColumns)) {}
+
+        [[nodiscard]] size_t findColumn(const std::type_index type) const noexcept {
+            const auto it = std::ranges::lower_bound(types, type);
+            return it != types.end() && *it == type ? static_cast<size_t>(it - types.begin()) : npos;
+        }
+
+        template<typename T>
+        [[nodiscard]] std::vector<T>& values(const size_t column) noexcept {
+            return static_cast<TypedColumn<T>&>(*columns[column]).getValues();
+        }
+
+        template<typename T>
+        [[nodiscard]] const std::vector<T>& values(const size_t column) const noexcept {
+            return static_cast<const TypedColumn<T>&>(*columns[column]).getValues();
+        }
+
+        template<typename T>
+        [[nodiscard]] std::vector<T>& values() noexcept {
+            return values<T>(findColumn(typeid(T)));
+        }
+
+        template<typename T>
+        [[nodiscard]] const std::vector<T>& values() const noexcept {
+            return values<T>(findColumn(typeid(T)));
+        }
+
+        /**
+         * @brief Removes a row, moving the last row into its place
+         * @return Entity now stored at row, or Entity::null() if the last row was removed
+         */
+        Entity swapRemove(const size_t row) noexcept {
+            for (const auto& column : columns) {
+                column->swapRemove(row);
+            }
+
+            const bool last = row + 1 == entities.size();
+            entities[row] = entities.back();
+            entities.pop_back();
+            return last ? Entity::null() : entities[row];
+        }
+
+        void reserve(const size_t capacity) {
+            entities.reserve(capacity);
+            for (const auto& column : columns) {
+                column->reserve(capacity);
+            }
+        }
+
+        /**
+         * @brief Drops every row from index size on, including rows only partly written
+         */
+        void truncate(const size_t size) noexcept {
+            for (const auto& column : columns) {
+                column->truncate(size);
+            }
+            entities.resize(size);
+        }
+
+        void clear() noexcept {
+            for (const auto& column : columns) {
+                column->clear();
+            }
+            entities.clear();
+        }
+
+        [[nodiscard]] const std::vector<std::type_index>& getTypes() const noexcept { return types; }
+        [[nodiscard]] ArchetypeColumn& getColumn(const size_t column) noexcept { return *columns[column]; }
+        [[nodiscard]] const ArchetypeColumn& getColumn(const size_t column) const noexcept { return *columns[column]; }
+        [[nodiscard]] size_t columnCount() const noexcept { return columns.size(); }
+        [[nodiscard]] std::vector<Entity>& getEntities() noexcept { return entities; }
+        [[nodiscard]] const std::vector<Entity>& getEntities() const noexcept { return entities; }
+        [[nodiscard]] size_t size() const noexcept { return entities.size(); }
+    };
+
+    /**
+     * @brief View over the archetypes that contain all of the specified components
+     *
+     * Matching tables are selected when the view is created; iteration walks each
+     * table's columns linearly with no per-entity lookups.
+     */
+    template<typename... Components>
+    class ArchetypeView {
+        std::vector<Archetype*> archetypes;
+
+    public:
+        explicit ArchetypeView(std::vector<Archetype*> matching) noexcept
+            : archetypes(std::move(matching)) {}
+
+        template<typename Func>
+        void each(Func&& function) const {
+            for (auto* archetype : archetypes) {
+                const auto& entities = archetype->getEntities();
+                const auto columns = std::make_tuple(archetype->values<Components>().data()...);
+
+                for (size_t row = 0; row < entities.size(); ++row) {
+                    if constexpr (std::is_invocable_v<Func, Entity, Components&...>) {
+                        function(entities[row], std::get<Components*>(columns)[row]...);
+                    } else if constexpr (std::is_invocable_v<Func, Components&...>) {
+                        function(std::get<Components*>(columns)[row]...);
+                    } else if constexpr (std::is_invocable_v<Func, Entity>) {
+                        function(entities[row]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Hands each matching table to the callback as whole column spans
+         */
+        template<typename Func>
+        void eachChunk(Func&& function) const {
+            for (auto* archetype : archetypes) {
+                if (archetype->size() == 0) continue;
+
+                function(std::span<const Entity>(archetype->getEntities()),
+                         std::span<Components>(archetype->values<Components>())...);
+            }
+        }
+
+        [[nodiscard]] size_t count() const noexcept {
+            size_t total = 0;
+            for (const auto* archetype : archetypes) {
+                total += archetype->size();
+            }
+            return total;
+        }
+    };
+
+    /**
+     * @brief ECS storing components in archetype tables instead of one sparse set per type
+     *
+     * Offers the same API as ECS so workloads can be compared on both backends. Adding or
+     * removing a component moves the entity's row to the table of its new component set,
+     * which is slower than a sparse set insert, in exchange for perfectly linear
+     * multi-component iteration.
+     */
+    class ArchetypeECS {
+        struct Location {
+            Archetype* archetype = nullptr;
+            size_t row = 0;
+        };
+
+        EntityManager entityManager;
+        std::map<std::vector<std::type_index>, std::unique_ptr<Archetype>> archetypes;
+        std::vector<Location> locations;
+
+        [[nodiscard]] Location& locate(const Entity entity) {
+            if (entity.getId() >= locations.size()) {
+                locations.resize(std::max<size_t>(entity.getId() + 1, locations.size() * 2));
+            }
+            return locations[entity.getId()];
+        }
+
+        [[nodiscard]] const Location* tryLocate(const Entity entity) const noexcept {
+            if (!isValid(entity) || entity.getId() >= locations.size()) return nullptr;
+            return &locations[entity.getId()];
+        }
+
+        template<typename T>
+        [[nodiscard]] T* find(const Entity entity) const noexcept {
+            const auto* location = tryLocate(entity);
+            if (!location || !location->archetype) return nullptr;
+
+            const auto column = location->archetype->findColumn(typeid(T));
+            return column == Archetype::npos ? nullptr : &location->archetype->values<T>(column)[location->row];
+        }
+
+        /**
+         * @brief Gets or creates the table for a component set
+         * @param source Table whose columns are cloned for the shared types, may be null
+         * @param added Column for a type that is not in source
+         */
+        Archetype& getArchetype(const std::vector<std::type_index>& types, const Archetype* source,
+                                std::unique_ptr<ArchetypeColumn> added = nullptr) {
+            if (const auto it = archetypes.find(types); it != archetypes.end()) {
+                return *it->second;
+            }
+
+            std::vector<std::unique_ptr<ArchetypeColumn>> columns;
+            columns.reserve(types.size());
+            for (const auto type : types) {
+                const auto column = source ? source->findColumn(type) : Archetype::npos;
+                columns.push_back(column != Archetype::npos ? source->getColumn(column).cloneEmpty() : std::move(added));
+            }
+
+            auto [inserted, success] = archetypes.try_emplace(types, std::make_unique<Archetype>(types, std::move(columns)));
+            return *inserted->second;
+        }
+
+        /**
+         * @brief Moves an entity's row to another table, carrying over the shared columns
+         *
+         * The target is grown before any value moves, so a failed allocation leaves both
+         * tables untouched; a throwing move constructor drops the partial target row.
+         */
+        void migrate(const Entity entity, Location& location, Archetype& target) {
+            auto* source = location.archetype;
+            const auto row = target.size();
+            target.reserve(row + 1);
+            target.getEntities().push_back(entity);
+
+            if (source) {
+                try {
+                    for (size_t column = 0; column < source->columnCount(); ++column) {
+                        const auto targetColumn = target.findColumn(source->getTypes()[column]);
+                        if (targetColumn != Archetype::npos) {
+                            source->getColumn(column).moveRowTo(location.row, target.getColumn(targetColumn));
+                        }
+                    }
+                } catch (...) {
+                    target.truncate(row);
+                    throw;
+                }
+                release(location);
+            }
+
+            location = Location{&target, row};
+        }
+
+        void release(const Location& location) noexcept {
+            if (const auto moved = location.archetype->swapRemove(location.row); moved != Entity::null()) {
+                locations[moved.getId()].row = location.row;
+            }
+        }
+
+        template<typename T, typename... Args>
+        T& attach(const Entity entity, Args&&... args) {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+
+            if (auto* existing = find<T>(entity)) {
+                return *existing;
+            }
+
+            // Built before the row moves, so a throwing constructor leaves the entity where it was
+            T value(std::forward<Args>(args)...);
+
+            auto& location = locate(entity);
+            auto types = location.archetype ? location.archetype->getTypes() : std::vector<std::type_index>{};
+            types.insert(std::ranges::upper_bound(types, std::type_index(typeid(T))), typeid(T));
+
+            // migrate() reserves the new column too, so the value is appended without reallocating
+            Archetype& target = getArchetype(types, location.archetype, std::make_unique<TypedColumn<T>>());
+            migrate(entity, location, target);
+
+            return target.values<T>().emplace_back(std::move(value));
+        }
+
+    public:
+        explicit ArchetypeECS(const size_t initialEntityCapacity = 1024)
+            : entityManager(initialEntityCapacity) {}
+
+        [[nodiscard]] Entity createEntity() noexcept {
+            return entityManager.create();
+        }
+
+        [[nodiscard]] bool isValid(const Entity entity) const noexcept {
+            return entityManager.isValid(entity);
+        }
+
+        void destroyEntity(const Entity entity) noexcept {
+            if (!isValid(entity)) return;
+
+            if (entity.getId() < locations.size()) {
+                auto& location = locations[entity.getId()];
+                if (location.archetype) {
+                    release(location);
+                }
+                location = Location{};
+            }
+
+            entityManager.destroy(entity);
+        }
+
+        /**
+         * @throws std::runtime_error if entity is invalid
+         */
+        template<typename T>
+        T& addComponent(const Entity entity, T&& component) {
+            return attach<std::remove_cvref_t<T>>(entity, std::forward<T>(component));
+        }
+
+        /**
+         * @throws std::runtime_error if entity is invalid
+         */
+        template<typename T, typename... Args>
+        T& emplaceComponent(const Entity entity, Args&&... args) {
+            return attach<T>(entity, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @throws std::runtime_error if entity is invalid
+         */
+        template<typename T>
+        T& replaceComponent(const Entity entity, T&& component) {
+            if (auto* existing = isValid(entity) ? find<std::remove_cvref_t<T>>(entity) : nullptr) {
+                *existing = std::forward<T>(component);
+                return *existing;
+            }
+            return addComponent(entity, std::forward<T>(component));
+        }
+
+        /**
+         * @throws std::runtime_error if entity is invalid or component not found
+         */
+        template<typename T>
+        [[nodiscard]] T& getComponent(const Entity entity) {
+            return const_cast<T&>(std::as_const(*this).getComponent<T>(entity));
+        }
+
+        /**
+         * @throws std::runtime_error if entity is invalid or component not found
+         */
+        template<typename T>
+        [[nodiscard]] const T& getComponent(const Entity entity) const {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+
+            const auto* component = find<T>(entity);
+            if (!component) {
+                throw std::runtime_error("Component type not found");
+            }
+            return *component;
+        }
+
+        template<typename T>
+        [[nodiscard]] bool hasComponent(const Entity entity) const noexcept {
+            return find<T>(entity) != nullptr;
+        }
+
+        template<typename First, typename... Rest>
+        [[nodiscard]] bool hasComponents(const Entity entity) const noexcept {
+            return hasComponent<First>(entity) && (hasComponent<Rest>(entity) && ...);
+        }
+
+        template<typename T>
+        void removeComponent(const Entity entity) {
+            if (!hasComponent<T>(entity)) return;
+
+            auto& location = locations[entity.getId()];
+            auto types = location.archetype->getTypes();
+            types.erase(std::ranges::find(types, std::type_index(typeid(T))));
+
+            if (types.empty()) {
+                release(location);
+                location = Location{};
+                return;
+            }
+
+            migrate(entity, location, getArchetype(types, location.archetype));
+        }
+
+        template<typename First, typename... Rest>
+        void removeComponents(const Entity entity) {
+            removeComponent<First>(entity);
+            (removeComponent<Rest>(entity), ...);
+        }
+
+        void clear() noexcept {
+            for (auto& [_, archetype] : archetypes) {
+                archetype->clear();
+            }
+            locations.clear();
+            entityManager.clear();
+        }
+
+        [[nodiscard]] size_t size() const noexcept {
+            return entityManager.size();
+        }
+
+        [[nodiscard]] size_t getEntityCapacity() const noexcept {
+            return entityManager.capacity();
+        }
+
+        [[nodiscard]] size_t archetypeCount() const noexcept {
+            return archetypes.size();
+        }
+
+        /**
+         * @brief Creates a view over every table that has all specified components
+         */
+        template<typename... Components>
+        [[nodiscard]] ArchetypeView<Components...> view() {
+            std::vector<Archetype*> matching;
+            for (const auto& [types, archetype] : archetypes) {
+                if ((std::ranges::binary_search(types, std::type_index(typeid(Components))) && ...)) {
+                    matching.push_back(archetype.get());
+                }
+            }
+            return ArchetypeView<Components...>{std::move(matching)};
+        }
+    };
+}
+
+#endif
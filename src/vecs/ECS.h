@@ -12,43 +12,161 @@
 #include <typeindex>
 
 #include "View.h"
+#include "Group.h"
+#include "RuntimeView.h"
+#include "StatePool.h"
 
 namespace vecs {
+    /**
+     * @brief Initial capacities of an ECS's storage
+     *
+     * The defaults reserve room for thousands of entities in the entity manager and in
+     * every pool as it is created, so large worlds do not reallocate early on.
+     * WorldConfig::minimal() reserves nothing: everything starts empty and grows with
+     * its contents, which suits programs running many small worlds at once. Any other
+     * capacity is reserved as given, rounded up to a power of two for pools and to
+     * whole pages for large entity capacities.
+     */
+    struct WorldConfig {
+        size_t entityCapacity = 8192;
+        size_t poolCapacity = 8192;
+
+        [[nodiscard]] static constexpr WorldConfig minimal() noexcept {
+            return WorldConfig{.entityCapacity = 0, .poolCapacity = 0};
+        }
+    };
+
     /**
      * @brief Core ECS (Entity Component System) implementation
      */
     class ECS {
         EntityManager entityManager;
         std::unordered_map<std::type_index, std::unique_ptr<BasePool>> pools;
+        std::unordered_map<std::type_index, std::unique_ptr<PoolListener>> groups;
+        Tick tick = 1;
+        // Capacity every pool reserves when it is created
+        size_t poolCapacity = WorldConfig{}.poolCapacity;
+
+        struct DisabledTag {};
+        FlagPool<DisabledTag> disabledEntities;
+
+        // Owning groups pack their entities at the front of their pools, where disabled entities cannot go
+        template<typename PoolType>
+        void checkAddable(const PoolType& pool, const Entity entity) const {
+            if (pool.getOwner() && disabledEntities.test(entity)) {
+                throw std::runtime_error("Cannot add a component owned by a group to a disabled entity");
+            }
+        }
 
-        template<typename T>
-        [[nodiscard]] Pool<T>& getPool() {
-            const auto typeIndex = std::type_index(typeid(T));
+        // Components added to a disabled entity join the disabled tail of their pool
+        template<typename PoolType>
+        void keepDisabled(PoolType& pool, const Entity entity) {
+            if (disabledEntities.test(entity)) {
+                pool.disable(entity);
+            }
+        }
+
+        template<typename PoolType>
+        [[nodiscard]] PoolType& getStorage(const std::type_index typeIndex) {
             const auto it = pools.find(typeIndex);
             if (it == pools.end()) {
                 auto [inserted, success] = pools.try_emplace(
                     typeIndex,
-                    std::make_unique<Pool<T>>()
+                    std::make_unique<PoolType>(poolCapacity)
                 );
-                return *static_cast<Pool<T>*>(inserted->second.get());
+                inserted->second->setTick(tick);
+                return *static_cast<PoolType*>(inserted->second.get());
             }
-            return *static_cast<Pool<T>*>(it->second.get());
+            return *static_cast<PoolType*>(it->second.get());
         }
 
-        template<typename T>
-        [[nodiscard]] const Pool<T>* tryGetPool() const noexcept {
-            const auto typeIndex = std::type_index(typeid(T));
+        template<typename PoolType>
+        [[nodiscard]] const PoolType* tryGetStorage(const std::type_index typeIndex) const noexcept {
             const auto it = pools.find(typeIndex);
             if (it == pools.end()) {
                 return nullptr;
             }
-            return static_cast<const Pool<T>*>(it->second.get());
+            return static_cast<const PoolType*>(it->second.get());
+        }
+
+        template<typename T>
+        [[nodiscard]] Pool<T>& getPool() {
+            static_assert(!FusedComponent<T>, "Fused components are stored through their Fused<...> type");
+            return getStorage<Pool<T>>(typeid(T));
+        }
+
+        template<typename T>
+        [[nodiscard]] const Pool<T>* tryGetPool() const noexcept {
+            static_assert(!FusedComponent<T>, "Fused components are stored through their Fused<...> type");
+            return tryGetStorage<Pool<T>>(typeid(T));
+        }
+
+        // Flag pools are keyed by their own type so T can also be used as a regular component
+        template<typename T>
+        [[nodiscard]] FlagPool<T>& getFlagPool() {
+            return getStorage<FlagPool<T>>(typeid(FlagPool<T>));
+        }
+
+        template<typename T>
+        [[nodiscard]] const FlagPool<T>* tryGetFlagPool() const noexcept {
+            return tryGetStorage<FlagPool<T>>(typeid(FlagPool<T>));
+        }
+
+        template<typename T>
+        [[nodiscard]] SharedPool<T>& getSharedPool() {
+            return getStorage<SharedPool<T>>(typeid(SharedPool<T>));
+        }
+
+        template<typename T>
+        [[nodiscard]] const SharedPool<T>* tryGetSharedPool() const noexcept {
+            return tryGetStorage<SharedPool<T>>(typeid(SharedPool<T>));
+        }
+
+        template<typename T>
+        [[nodiscard]] StatePool<T>& getStatePool() {
+            return getStorage<StatePool<T>>(typeid(StatePool<T>));
+        }
+
+        template<typename T>
+        [[nodiscard]] const StatePool<T>* tryGetStatePool() const noexcept {
+            return tryGetStorage<StatePool<T>>(typeid(StatePool<T>));
+        }
+
+        template<typename C>
+        [[nodiscard]] typename ViewComponent<C>::Storage viewStorage() {
+            if constexpr (isFlag<C>) {
+                return {&getFlagPool<typename ViewComponent<C>::Component>()};
+            } else if constexpr (isShared<C>) {
+                return {&getSharedPool<typename ViewComponent<C>::Component>()};
+            } else if constexpr (FusedComponent<typename ViewComponent<C>::Component>) {
+                return {&getPool<typename ViewComponent<C>::Fusion>()};
+            } else {
+                return {&getPool<typename ViewComponent<C>::Component>()};
+            }
+        }
+
+        template<typename C>
+        [[nodiscard]] typename ViewComponent<C>::Storage viewStorage() const noexcept {
+            if constexpr (isFlag<C>) {
+                return {tryGetFlagPool<typename ViewComponent<C>::Component>()};
+            } else if constexpr (isShared<C>) {
+                return {tryGetSharedPool<typename ViewComponent<C>::Component>()};
+            } else if constexpr (FusedComponent<typename ViewComponent<C>::Component>) {
+                return {tryGetPool<typename ViewComponent<C>::Fusion>()};
+            } else {
+                return {tryGetPool<typename ViewComponent<C>::Component>()};
+            }
         }
 
     public:
-        explicit ECS(const size_t initialEntityCapacity = 1024)
+        ECS() : ECS(WorldConfig{}) {}
+
+        explicit ECS(const size_t initialEntityCapacity)
             : entityManager(initialEntityCapacity) {}
 
+        explicit ECS(const WorldConfig& config)
+            : entityManager(config.entityCapacity), poolCapacity(config.poolCapacity) {}
+
         /**
          * @brief Creates a new entity
          * @return Newly created entity
@@ -77,6 +195,7 @@ namespace vecs {
                 pool->removeEntity(entity);
             }
 
+            disabledEntities.reset(entity);
             entityManager.destroy(entity);
         }
 
@@ -85,7 +204,7 @@ namespace vecs {
          * @param entity Target entity
          * @param component Component to add
          * @return Reference to the added component
-         * @throws std::runtime_error if entity is invalid
+         * @throws std::runtime_error if entity is invalid, or disabled while T is owned by a group
          */
         template<typename T>
         T& addComponent(Entity entity, T&& component) {
@@ -94,7 +213,9 @@ namespace vecs {
             }
 
             auto& pool = getPool<T>();
+            checkAddable(pool, entity);
             pool.insert(entity, std::forward<T>(component));
+            keepDisabled(pool, entity);
             return pool.get(entity);
         }
 
@@ -103,7 +224,7 @@ namespace vecs {
          * @param entity Target entity
          * @param args Arguments for component construction
          * @return Reference to the created component
-         * @throws std::runtime_error if entity is invalid
+         * @throws std::runtime_error if entity is invalid, or disabled while T is owned by a group
          */
         template<typename T, typename... Args>
         T& emplaceComponent(Entity entity, Args&&... args) {
@@ -111,7 +232,13 @@ namespace vecs {
                 throw std::runtime_error("Invalid entity");
             }
 
-            return getPool<T>().emplace(entity, std::forward<Args>(args)...);
+            auto& pool = getPool<T>();
+            checkAddable(pool, entity);
+            auto& component = pool.emplace(entity, std::forward<Args>(args)...);
+            if (!disabledEntities.test(entity)) return component;
+
+            pool.disable(entity);
+            return pool.get(entity);
         }
 
         /**
@@ -119,7 +246,7 @@ namespace vecs {
          * @param entity Target entity
          * @param component New component value
          * @return Reference to the component
-         * @throws std::runtime_error if entity is invalid
+         * @throws std::runtime_error if entity is invalid, or disabled while T is owned by a group
          */
         template<typename T>
         T& replaceComponent(Entity entity, T&& component) {
@@ -129,7 +256,9 @@ namespace vecs {
 
             auto& pool = getPool<T>();
             if (!pool.has(entity)) {
+                checkAddable(pool, entity);
                 pool.insert(entity, std::forward<T>(component));
+                keepDisabled(pool, entity);
             } else {
                 pool.get(entity) = std::forward<T>(component);
             }
@@ -147,7 +276,11 @@ namespace vecs {
             if (!isValid(entity)) {
                 throw std::runtime_error("Invalid entity");
             }
-            return getPool<T>().get(entity);
+            if constexpr (FusedComponent<T>) {
+                return getPool<FusedStorageType<T>>().get(entity).template get<T>();
+            } else {
+                return getPool<T>().get(entity);
+            }
         }
 
         /**
@@ -162,13 +295,295 @@ namespace vecs {
                 throw std::runtime_error("Invalid entity");
             }
 
-            const auto* pool = tryGetPool<T>();
-            if (!pool) {
+            if constexpr (FusedComponent<T>) {
+                const auto* pool = tryGetPool<FusedStorageType<T>>();
+                if (!pool) {
+                    throw std::runtime_error("Component type not found");
+                }
+                return pool->get(entity).template get<T>();
+            } else {
+                const auto* pool = tryGetPool<T>();
+                if (!pool) {
+                    throw std::runtime_error("Component type not found");
+                }
+                return pool->get(entity);
+            }
+        }
+
+        /**
+         * @brief Gets the cold part of a split component
+         * @param entity Target entity
+         * @return Reference to the component's T::Cold data
+         * @throws std::runtime_error if entity is invalid or component not found
+         */
+        template<SplitComponent T>
+        [[nodiscard]] typename T::Cold& getColdComponent(Entity entity) {
+            if (!hasComponent<T>(entity)) {
+                throw std::runtime_error(isValid(entity) ? "Component type not found" : "Invalid entity");
+            }
+            return getPool<T>().getCold(entity);
+        }
+
+        /**
+         * @brief Gets the cold part of a split component (const)
+         * @param entity Target entity
+         * @return Const reference to the component's T::Cold data
+         * @throws std::runtime_error if entity is invalid or component not found
+         */
+        template<SplitComponent T>
+        [[nodiscard]] const typename T::Cold& getColdComponent(Entity entity) const {
+            if (!hasComponent<T>(entity)) {
+                throw std::runtime_error(isValid(entity) ? "Component type not found" : "Invalid entity");
+            }
+            return tryGetPool<T>()->getCold(entity);
+        }
+
+        /**
+         * @brief Disables an entity without removing its components
+         *
+         * Each of the entity's components is swapped into the disabled tail of its pool,
+         * so views, queries and non-owning groups skip it until it is enabled again. Owning
+         * groups refuse disabled entities, and flag and state storages ignore the disabled
+         * state.
+         * @param entity Target entity
+         * @throws std::runtime_error if entity is invalid or one of its pools is owned by a group
+         */
+        void disable(const Entity entity) {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+            if (disabledEntities.test(entity)) return;
+
+            for (const auto& [_, pool] : pools) {
+                if (pool->getOwner() && pool->probe().contains(entity)) {
+                    throw std::runtime_error("Cannot disable an entity in a pool owned by a group");
+                }
+            }
+
+            for (auto& [_, pool] : pools) {
+                pool->disable(entity);
+            }
+            disabledEntities.set(entity);
+        }
+
+        /**
+         * @brief Enables a disabled entity, making it visible to views again
+         * @param entity Target entity
+         */
+        void enable(const Entity entity) {
+            if (!isValid(entity) || !disabledEntities.reset(entity)) return;
+
+            for (auto& [_, pool] : pools) {
+                pool->enable(entity);
+            }
+        }
+
+        [[nodiscard]] bool isEnabled(const Entity entity) const noexcept {
+            return isValid(entity) && !disabledEntities.test(entity);
+        }
+
+        [[nodiscard]] size_t disabledCount() const noexcept {
+            return disabledEntities.size();
+        }
+
+        /**
+         * @brief Adds a component whose value is shared with every entity holding an equal one
+         *
+         * Shared components live in a SharedPool, which stores each distinct value once,
+         * and are read in views through vecs::Shared<T>. Replaces the entity's previous value.
+         * @param entity Target entity
+         * @param value Value to share
+         * @return Const reference to the shared instance
+         * @throws std::runtime_error if entity is invalid
+         */
+        template<ShareableComponent T>
+        const T& addSharedComponent(const Entity entity, const T& value) {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+            auto& pool = getSharedPool<T>();
+            const auto& shared = pool.insert(entity, value);
+            keepDisabled(pool, entity);
+            return shared;
+        }
+
+        /**
+         * @brief Gets the shared value of an entity's component
+         * @param entity Target entity
+         * @return Const reference to the shared instance
+         * @throws std::runtime_error if entity is invalid or component not found
+         */
+        template<ShareableComponent T>
+        [[nodiscard]] const T& getSharedComponent(const Entity entity) const {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+
+            const auto* pool = tryGetSharedPool<T>();
+            if (!pool || !pool->has(entity)) {
+                throw std::runtime_error("Component type not found");
+            }
+            return pool->get(entity);
+        }
+
+        template<ShareableComponent T>
+        [[nodiscard]] bool hasSharedComponent(const Entity entity) const noexcept {
+            const auto* pool = tryGetSharedPool<T>();
+            return pool && isValid(entity) && pool->has(entity);
+        }
+
+        template<ShareableComponent T>
+        void removeSharedComponent(const Entity entity) noexcept {
+            if (!isValid(entity)) return;
+
+            if (auto* pool = const_cast<SharedPool<T>*>(tryGetSharedPool<T>())) {
+                pool->removeEntity(entity);
+            }
+        }
+
+        /**
+         * @brief Gets the number of distinct values stored for a shared component
+         */
+        template<ShareableComponent T>
+        [[nodiscard]] size_t sharedValueCount() const noexcept {
+            const auto* pool = tryGetSharedPool<T>();
+            return pool ? pool->uniqueCount() : 0;
+        }
+
+        /**
+         * @brief Sets the value of an enum state component, moving the entity to its partition
+         *
+         * State components live in a StatePool that keeps the entities of each state
+         * contiguous, see entitiesInState.
+         * @param entity Target entity
+         * @param state New state
+         * @throws std::runtime_error if entity is invalid or state is out of range
+         */
+        template<StateComponent T>
+        void setState(const Entity entity, const T state) {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+            getStatePool<T>().insert(entity, state);
+        }
+
+        /**
+         * @brief Gets the value of an entity's state component
+         * @throws std::runtime_error if entity is invalid or component not found
+         */
+        template<StateComponent T>
+        [[nodiscard]] T getState(const Entity entity) const {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+
+            const auto* pool = tryGetStatePool<T>();
+            if (!pool || !pool->has(entity)) {
                 throw std::runtime_error("Component type not found");
             }
             return pool->get(entity);
         }
 
+        template<StateComponent T>
+        [[nodiscard]] bool hasState(const Entity entity) const noexcept {
+            const auto* pool = tryGetStatePool<T>();
+            return pool && isValid(entity) && pool->has(entity);
+        }
+
+        template<StateComponent T>
+        void removeState(const Entity entity) noexcept {
+            if (!isValid(entity)) return;
+
+            if (auto* pool = const_cast<StatePool<T>*>(tryGetStatePool<T>())) {
+                pool->removeEntity(entity);
+            }
+        }
+
+        /**
+         * @brief Gets the contiguous slice of entities in a state
+         *
+         * Invalidated when any entity changes state or the component is added or removed.
+         * Empty for a state out of range.
+         */
+        template<StateComponent T>
+        [[nodiscard]] std::span<const Entity> entitiesInState(const T state) const noexcept {
+            const auto* pool = tryGetStatePool<T>();
+            return pool ? pool->entities(state) : std::span<const Entity>{};
+        }
+
+        /**
+         * @brief Calls function with every entity in a state, without testing each entity
+         *
+         * States must not change while iterating.
+         */
+        template<StateComponent T, typename Func>
+        void eachInState(const T state, Func&& function) const {
+            for (const auto entity : entitiesInState(state)) {
+                function(entity);
+            }
+        }
+
+        /**
+         * @brief Sets a boolean flag on an entity
+         *
+         * Flags are stored as one bit per entity ID in a FlagPool and can filter views
+         * through vecs::Flag<T>.
+         * @param entity Target entity
+         * @throws std::runtime_error if entity is invalid
+         */
+        template<typename T>
+        void setFlag(const Entity entity) {
+            if (!isValid(entity)) {
+                throw std::runtime_error("Invalid entity");
+            }
+            getFlagPool<T>().set(entity);
+        }
+
+        /**
+         * @brief Clears a boolean flag on an entity
+         * @param entity Target entity
+         */
+        template<typename T>
+        void clearFlag(const Entity entity) noexcept {
+            if (!isValid(entity)) return;
+
+            if (auto* pool = const_cast<FlagPool<T>*>(tryGetFlagPool<T>())) {
+                pool->reset(entity);
+            }
+        }
+
+        /**
+         * @brief Checks if a boolean flag is set on an entity
+         * @param entity Target entity
+         * @return True if entity is valid and has the flag
+         */
+        template<typename T>
+        [[nodiscard]] bool hasFlag(const Entity entity) const noexcept {
+            const auto* pool = tryGetFlagPool<T>();
+            return pool && isValid(entity) && pool->test(entity);
+        }
+
+        /**
+         * @brief Gets the number of entities with a flag set, maintained on every change
+         */
+        template<typename T>
+        [[nodiscard]] size_t flagCount() const noexcept {
+            const auto* pool = tryGetFlagPool<T>();
+            return pool ? pool->size() : 0;
+        }
+
+        /**
+         * @brief Calls function with every entity that has a flag set, in ascending ID order
+         */
+        template<typename T, typename Func>
+        void eachFlagged(Func&& function) const {
+            if (const auto* pool = tryGetFlagPool<T>()) {
+                pool->each([this, &function](const EntityId id) {
+                    function(entityManager.get(id));
+                });
+            }
+        }
+
         /**
          * @brief Checks if an entity has a component
          * @param entity Target entity
@@ -178,10 +593,15 @@ namespace vecs {
         [[nodiscard]] bool hasComponent(Entity entity) const noexcept {
             if (!isValid(entity)) return false;
 
-            const auto* pool = tryGetPool<T>();
-            if (!pool) return false;
+            if constexpr (FusedComponent<T>) {
+                const auto* pool = tryGetPool<FusedStorageType<T>>();
+                return pool && pool->has(entity);
+            } else {
+                const auto* pool = tryGetPool<T>();
+                if (!pool) return false;
 
-            return pool->has(entity);
+                return pool->has(entity);
+            }
         }
 
         /**
@@ -224,9 +644,109 @@ namespace vecs {
             for (auto& [_, pool] : pools) {
                 pool->clear();
             }
+            disabledEntities.clear();
             entityManager.clear();
         }
 
+        /**
+         * @brief Renumbers live entities to the lowest IDs so sparse arrays can shrink
+         *
+         * A maintenance operation: every pool's dense and sparse arrays are rewritten.
+         * Entities whose ID moves get a new handle and their old one becomes invalid, while
+         * entities already in place keep theirs; translate every handle held outside the
+         * ECS through the returned table. Follow with shrink() to release the freed sparse
+         * space.
+         * @return Table indexed by old entity ID holding the new entity, null for IDs not in use
+         */
+        std::vector<Entity> compactIds() {
+            auto table = entityManager.compact();
+            const std::span<const Entity> remap(table);
+
+            for (auto& [_, pool] : pools) {
+                pool->remapEntities(remap);
+            }
+            for (auto& [_, group] : groups) {
+                group->onRemap(remap);
+            }
+            disabledEntities.remapEntities(remap);
+            return table;
+        }
+
+        /**
+         * @brief Returns memory kept from past load peaks to the allocator
+         *
+         * Trims every pool with shrinkToFit and the entity bookkeeping. Pools and views
+         * regrow on demand, so this is meant for quiet moments after a despawn wave.
+         * @param compactIds Also drop destroyed entity IDs above the highest live one,
+         * see EntityManager::shrinkToFit
+         */
+        void shrink(const bool compactIds = false) {
+            for (auto& [_, pool] : pools) {
+                pool->shrinkToFit();
+            }
+            disabledEntities.shrinkToFit();
+            entityManager.shrinkToFit(compactIds);
+        }
+
+        /**
+         * @brief Gets the memory held by every pool and the entity bookkeeping
+         *
+         * Walks each pool once; meant for tooling and capacity planning rather than
+         * per-frame use.
+         */
+        [[nodiscard]] WorldMemoryStats memoryStats() const noexcept {
+            WorldMemoryStats stats;
+            stats.entities = entityManager.memoryStats();
+            for (const auto& [_, pool] : pools) {
+                stats.pools += pool->memoryStats();
+                ++stats.poolCount;
+            }
+            stats.pools += disabledEntities.memoryStats();
+            return stats;
+        }
+
+        /**
+         * @brief Gets the memory held by a component pool
+         * @return Empty stats if no pool exists for T
+         */
+        template<typename T>
+        [[nodiscard]] MemoryStats memoryStats() const noexcept {
+            const auto* pool = tryGetPool<T>();
+            return pool ? pool->memoryStats() : MemoryStats{};
+        }
+
+        /**
+         * @brief Puts a component pool's dense array back in ascending entity ID order
+         *
+         * Swap-and-pop removals scatter the dense order over time; in ID order, joins
+         * probe the other pools' sparse arrays front to back.
+         * @throws std::runtime_error if the pool is owned by a group
+         */
+        template<typename T>
+        void sortByEntity() {
+            if (auto* pool = const_cast<Pool<T>*>(tryGetPool<T>())) {
+                pool->sortByEntity();
+            }
+        }
+
+        /**
+         * @brief Spends a bounded amount of work restoring entity ID order across pools
+         *
+         * Meant to be called once per frame with a small budget: each call resumes where
+         * the previous one stopped, so pools get back in order over several frames
+         * without a spike. Pools owned by a group are left alone.
+         * @param budget Maximum number of entity IDs visited across all pools
+         * @return Number of entity IDs visited, 0 once every pool is in order
+         */
+        size_t defragment(const size_t budget) {
+            size_t visited = 0;
+            for (auto& [_, pool] : pools) {
+                if (visited >= budget) break;
+                visited += pool->defragment(budget - visited);
+            }
+            return visited;
+        }
+
         /**
          * @brief Gets the number of active entities
          */
@@ -241,6 +761,37 @@ namespace vecs {
             return entityManager.capacity();
         }
 
+        /**
+         * @brief Starts a new tick, typically once per frame
+         *
+         * Storage chunks changed from now on are stamped with the new tick, so a system
+         * can skip chunks that did not change since the tick it last ran.
+         * @return The new tick
+         */
+        Tick advanceTick() noexcept {
+            ++tick;
+            for (auto& [_, pool] : pools) {
+                pool->setTick(tick);
+            }
+            return tick;
+        }
+
+        [[nodiscard]] Tick getTick() const noexcept {
+            return tick;
+        }
+
+        /**
+         * @brief Stamps the storage chunk holding an entity's component as changed
+         *
+         * Does nothing unless T is chunk-tracked, see TrackChunks.
+         */
+        template<typename T>
+        void markChanged(const Entity entity) {
+            if (auto* pool = const_cast<Pool<T>*>(tryGetPool<T>())) {
+                pool->markChanged(entity);
+            }
+        }
+
         /**
          * @brief Gets a component pool
          * @return Pointer to the component pool or nullptr if not found
@@ -250,15 +801,107 @@ namespace vecs {
             return tryGetPool<T>();
         }
 
+        /**
+         * @brief Makes the pool of T maintain a presence bitset indexed by entity ID
+         *
+         * Views whose required pools all track presence intersect the bitsets a word at
+         * a time instead of probing each pool per entity, and count() becomes a popcount.
+         * @param enabled False drops the bitset again
+         */
+        template<typename T>
+        void trackPresence(const bool enabled = true) {
+            getPool<T>().trackPresence(enabled);
+        }
+
+        /**
+         * @brief Gets a component pool by runtime type
+         * @return Pointer to the component pool or nullptr if not found
+         */
+        [[nodiscard]] const BasePool* getComponentPool(const std::type_index type) const noexcept {
+            const auto it = pools.find(type);
+            return it == pools.end() ? nullptr : it->second.get();
+        }
+
+        /**
+         * @brief Creates a view over component types known only at runtime
+         * @param types Component types an entity must have
+         * @return Runtime view, empty if any of the pools does not exist
+         */
+        [[nodiscard]] RuntimeView runtimeView(const std::span<const std::type_index> types) const {
+            std::vector<const BasePool*> componentPools;
+            componentPools.reserve(types.size());
+            for (const auto type : types) {
+                componentPools.push_back(getComponentPool(type));
+            }
+            return RuntimeView{std::move(componentPools)};
+        }
+
         /**
          * @brief Creates a view for iterating over entities with specific components
          * @return View instance for the specified component types
          */
         template<typename... Components>
         [[nodiscard]] View<Components...> view() {
-            return View<Components...>{std::make_tuple(
-                &getPool<Components>()...
-            )};
+            return View<Components...>{std::make_tuple(viewStorage<Components>()...)};
+        }
+
+        /**
+         * @brief Creates a read-only view without creating missing pools
+         * @return View over the specified const components, empty if any pool does not exist
+         */
+        template<typename... Components>
+        [[nodiscard]] View<Components...> view() const {
+            static_assert((ViewComponent<Components>::readOnly && ...),
+                "Views on a const ECS must use const components");
+
+            return View<Components...>{std::make_tuple(viewStorage<Components>()...)};
+        }
+
+        /**
+         * @brief Gets or creates a group over the specified components
+         *
+         * Owned components are packed at the front of their pools; referenced components
+         * passed through vecs::get are only looked up. Without owned components the group
+         * is non-owning and caches the list of matching entities instead.
+         * @return Group over entities having all owned and referenced components
+         * @throws std::runtime_error if one of the owned pools is already owned by another group
+         * or holds disabled entities
+         */
+        template<typename... Owned, typename... Referenced>
+        [[nodiscard]] BasicGroup<Get<Referenced...>, Owned...>& group(Get<Referenced...> = Get<Referenced...>{}) {
+            using GroupType = BasicGroup<Get<Referenced...>, Owned...>;
+
+            const auto typeIndex = std::type_index(typeid(GroupType));
+            if (const auto it = groups.find(typeIndex); it != groups.end()) {
+                return *static_cast<GroupType*>(it->second.get());
+            }
+
+            if ((getPool<Owned>().getOwner() || ...)) {
+                throw std::runtime_error("Component pool is already owned by another group");
+            }
+            if (((getPool<Owned>().activeSize() != getPool<Owned>().size()) || ...)) {
+                throw std::runtime_error("Component pool holds disabled entities");
+            }
+
+            auto [inserted, success] = groups.try_emplace(
+                typeIndex,
+                std::make_unique<GroupType>(&getPool<Owned>()..., &getPool<Referenced>()...)
+            );
+            return *static_cast<GroupType*>(inserted->second.get());
+        }
+
+        /**
+         * @brief Gets or creates a cached query over the specified components
+         *
+         * The query is registered with the ECS and maintained incrementally, which suits
+         * combinations that change rarely but are iterated every frame. Equivalent to
+         * group<>(vecs::get<Components...>).
+         * @return Query over entities having all components
+         */
+        template<typename... Components>
+        [[nodiscard]] Query<Components...>& query() {
+            static_assert(sizeof...(Components) > 0, "A query must have at least one component");
+            return group<>(get<Components...>);
         }
     };
 }
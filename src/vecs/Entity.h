@@ -4,11 +4,14 @@
 #ifndef ENTITY_H
 #define ENTITY_H
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 #include <queue>
 #include <limits>
 
+#include "MemoryStats.h"
+
 namespace vecs {
     using EntityId = std::uint32_t;
     using Version = std::uint32_t;
@@ -61,6 +64,9 @@ namespace vecs {
         alignas(64) std::vector<Entity> validEntities;
         alignas(64) std::vector<EntityId> recycledIds;
         EntityId nextId = 0;
+        // One past the highest ID handed out; compact() lowers nextId but the versions
+        // it bumped up to here must outlive it
+        EntityId issuedIds = 0;
 
         static constexpr size_t pageSize = 4096;
         static constexpr size_t pageMask = ~(pageSize - 1);
@@ -70,8 +76,12 @@ namespace vecs {
         }
 
     public:
+        /**
+         * @param requestedCapacity Entities to reserve room for, rounded up to whole pages
+         * once it reaches pageSize; 0 allocates nothing until the first entity is created
+         */
         explicit EntityManager(const size_t requestedCapacity = initialCapacity) {
-            const size_t capacity = alignToPage(std::max(requestedCapacity, initialCapacity));
+            const size_t capacity = requestedCapacity >= pageSize ? alignToPage(requestedCapacity) : requestedCapacity;
             versions.reserve(capacity);
             validEntities.reserve(capacity);
             recycledIds.reserve(capacity / 4);
@@ -85,8 +95,11 @@ namespace vecs {
                 recycledIds.pop_back();
             } else {
                 id = nextId++;
+                issuedIds = std::max(issuedIds, nextId);
                 if (id >= versions.size()) {
-                    const size_t newSize = alignToPage(std::max<size_t>(id + 1, versions.size() * 2));
+                    // Managers that reserved nothing double from one slot until they reach a page
+                    size_t newSize = std::max<size_t>(id + 1, versions.size() * 2);
+                    if (versions.capacity() >= pageSize) newSize = alignToPage(newSize);
                     versions.resize(newSize, 0);
                 }
             }
@@ -112,6 +125,13 @@ namespace vecs {
             recycledIds.push_back(id);
         }
 
+        /**
+         * @brief Gets the current entity for an ID that is in use
+         */
+        [[nodiscard]] Entity get(const EntityId id) const noexcept {
+            return Entity{versions[id] << EntityConstants::versionShift | id};
+        }
+
         [[nodiscard]] bool isValid(const Entity entity) const noexcept {
             const auto id = entity.getId();
             return id < versions.size() && versions[id] == entity.getVersion();
@@ -122,6 +142,62 @@ namespace vecs {
             validEntities.clear();
             recycledIds.clear();
             nextId = 0;
+            issuedIds = 0;
+        }
+
+        /**
+         * @brief Renumbers the live entities to IDs 0 to size() - 1, keeping their order
+         *
+         * Every slot an entity leaves gets a new version and every slot it moves into
+         * already has a version above any destroyed handle, so no handle from before the
+         * compaction matches a different entity afterwards.
+         * @return Table indexed by old ID holding the new entity, null for unused IDs
+         */
+        [[nodiscard]] std::vector<Entity> compact() {
+            std::vector<Entity> remap(nextId, Entity::null());
+            std::ranges::sort(validEntities, {}, &Entity::getId);
+
+            EntityId next = 0;
+            for (auto& entity : validEntities) {
+                const auto from = entity.getId();
+                const auto to = next++;
+                if (from != to) {
+                    versions[from] = (versions[from] + 1) & EntityConstants::versionMask;
+                }
+                entity = Entity{versions[to] << EntityConstants::versionShift | to};
+                remap[from] = entity;
+            }
+
+            recycledIds.clear();
+            nextId = next;
+            return remap;
+        }
+
+        /**
+         * @brief Releases memory kept from past peaks
+         * @param compactIds Also forgets destroyed IDs above the highest live one, including
+         * those vacated by compact(), so the version array ends at the highest live ID.
+         * Their versions restart at 0, so a stale handle to one of them may match a new
+         * entity; only use this when no such handles are kept.
+         */
+        void shrinkToFit(const bool compactIds = false) {
+            if (compactIds) {
+                std::vector<bool> recycled(nextId, false);
+                for (const auto id : recycledIds) {
+                    recycled[id] = true;
+                }
+                while (nextId > 0 && recycled[nextId - 1]) {
+                    --nextId;
+                }
+                std::erase_if(recycledIds, [this](const EntityId id) { return id >= nextId; });
+                issuedIds = nextId;
+            }
+
+            // Without compactIds, versions above nextId left by compact() are kept
+            versions.resize(issuedIds);
+            versions.shrink_to_fit();
+            validEntities.shrink_to_fit();
+            recycledIds.shrink_to_fit();
         }
 
         [[nodiscard]] size_t size() const noexcept {
@@ -132,6 +208,17 @@ namespace vecs {
             return versions.capacity();
         }
 
+        [[nodiscard]] EntityMemoryStats memoryStats() const noexcept {
+            return EntityMemoryStats{
+                .versionBytes = versions.capacity() * sizeof(Version),
+                .validEntityBytes = validEntities.capacity() * sizeof(Entity),
+                .recycledIdBytes = recycledIds.capacity() * sizeof(EntityId),
+                .size = validEntities.size(),
+                .idSlots = versions.size(),
+                .recycled = recycledIds.size(),
+            };
+        }
+
         [[nodiscard]] const std::vector<Entity>& getValidEntities() const noexcept {
             return validEntities;
         }
@@ -0,0 +1,163 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef FLAGPOOL_H
+#define FLAGPOOL_H
+
+#include <bit>
+#include <vector>
+#include "Pool.h"
+
+namespace vecs {
+    /**
+     * @brief Boolean flag storage keeping a single bit per entity ID
+     *
+     * Replaces the sparse, dense and component arrays of a Pool for high-cardinality
+     * tags such as IsVisible. Bits are indexed by ID only, so destroying an entity
+     * clears its flags before the ID is recycled.
+     */
+    template<typename T>
+    class FlagPool final : public BasePool {
+        std::vector<PresenceWord> bits;
+        size_t count = 0;
+
+        static constexpr size_t lanes = 4;
+
+    public:
+        FlagPool() = default;
+
+        /**
+         * @param initialCapacity Entity IDs to reserve bits for
+         */
+        explicit FlagPool(const size_t initialCapacity) {
+            bits.reserve((initialCapacity + presenceWordBits - 1) / presenceWordBits);
+        }
+
+        /**
+         * @return True if the flag was not set before
+         */
+        bool set(const Entity entity) {
+            const auto id = entity.getId();
+            if (id / presenceWordBits >= bits.size()) {
+                bits.resize(std::max<size_t>(id / presenceWordBits + 1, bits.size() * 2), 0);
+            }
+
+            auto& word = bits[id / presenceWordBits];
+            const auto mask = PresenceWord{1} << (id % presenceWordBits);
+            if (word & mask) return false;
+
+            word |= mask;
+            ++count;
+            return true;
+        }
+
+        /**
+         * @return True if the flag was set before
+         */
+        bool reset(const Entity entity) noexcept {
+            const auto id = entity.getId();
+            if (id / presenceWordBits >= bits.size()) return false;
+
+            auto& word = bits[id / presenceWordBits];
+            const auto mask = PresenceWord{1} << (id % presenceWordBits);
+            if (!(word & mask)) return false;
+
+            word &= ~mask;
+            --count;
+            return true;
+        }
+
+        [[nodiscard]] bool test(const Entity entity) const noexcept {
+            const auto id = entity.getId();
+            return id / presenceWordBits < bits.size() &&
+                   (bits[id / presenceWordBits] >> (id % presenceWordBits) & 1) != 0;
+        }
+
+        /**
+         * @brief Visits the ID of every set flag in ascending order
+         *
+         * Skips empty blocks of lanes words (256 bits) at once, a fixed-width test the
+         * compiler turns into vector instructions.
+         */
+        template<typename Func>
+        void each(Func&& function) const {
+            auto visit = [&function](const size_t index, PresenceWord word) {
+                while (word != 0) {
+                    function(static_cast<EntityId>(index * presenceWordBits + std::countr_zero(word)));
+                    word &= word - 1;
+                }
+            };
+
+            size_t base = 0;
+            for (; base + lanes <= bits.size(); base += lanes) {
+                PresenceWord any = 0;
+                for (size_t lane = 0; lane < lanes; ++lane) {
+                    any |= bits[base + lane];
+                }
+                if (any == 0) continue;
+
+                for (size_t lane = 0; lane < lanes; ++lane) {
+                    visit(base + lane, bits[base + lane]);
+                }
+            }
+            for (; base < bits.size(); ++base) {
+                visit(base, bits[base]);
+            }
+        }
+
+        void removeEntity(const Entity entity) override {
+            reset(entity);
+        }
+
+        [[nodiscard]] size_t size() const override {
+            return count;
+        }
+
+        void clear() override {
+            std::ranges::fill(bits, PresenceWord{0});
+            count = 0;
+        }
+
+        void reserve(const size_t capacity) override {
+            bits.resize(std::max(bits.size(), (capacity + presenceWordBits - 1) / presenceWordBits), 0);
+        }
+
+        void remapEntities(const std::span<const Entity> table) override {
+            std::vector<PresenceWord> remapped(bits.size(), 0);
+            each([&remapped, table](const EntityId id) {
+                const auto target = table[id].getId();
+                remapped[target / presenceWordBits] |= PresenceWord{1} << (target % presenceWordBits);
+            });
+            bits = std::move(remapped);
+        }
+
+        void shrinkToFit() override {
+            while (!bits.empty() && bits.back() == 0) {
+                bits.pop_back();
+            }
+            bits.shrink_to_fit();
+        }
+
+        [[nodiscard]] EntityProbe probe() const noexcept override {
+            return EntityProbe::membership(bits, count);
+        }
+
+        /**
+         * @brief Gets the memory held by the bitset, which doubles as the pool's capacity
+         */
+        [[nodiscard]] MemoryStats memoryStats() const noexcept override {
+            const auto slots = bits.size() * presenceWordBits;
+            return MemoryStats{
+                .sparseBytes = bits.capacity() * sizeof(PresenceWord),
+                .size = count,
+                .capacity = bits.capacity() * presenceWordBits,
+                .sparseSlots = slots,
+                .emptySparseSlots = slots - count,
+            };
+        }
+
+        [[nodiscard]] const auto& getBits() const noexcept { return bits; }
+    };
+}
+
+#endif
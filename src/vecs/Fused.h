@@ -0,0 +1,51 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef FUSED_H
+#define FUSED_H
+
+#include <tuple>
+#include <type_traits>
+
+namespace vecs {
+    /**
+     * @brief Stores components that always appear together side by side in one pool
+     *
+     * Pool<Fused<Position, Velocity>> keeps a single sparse and dense index for both
+     * components instead of one per pool. Declare the fusion for every member through
+     * FusedStorage so views and component accessors find it.
+     */
+    template<typename... Components>
+    struct Fused {
+        static_assert(sizeof...(Components) > 1, "Fused needs at least two components");
+
+        std::tuple<Components...> components;
+
+        Fused() = default;
+
+        explicit Fused(Components... values)
+            : components(std::move(values)...) {}
+
+        template<typename T>
+        [[nodiscard]] T& get() noexcept { return std::get<T>(components); }
+
+        template<typename T>
+        [[nodiscard]] const T& get() const noexcept { return std::get<T>(components); }
+    };
+
+    /**
+     * @brief Specialize to store T inside a fused pool
+     *
+     * template<> struct vecs::FusedStorage<Position> { using Type = vecs::Fused<Position, Velocity>; };
+     */
+    template<typename T>
+    struct FusedStorage {};
+
+    template<typename T>
+    concept FusedComponent = requires { typename FusedStorage<T>::Type; };
+
+    template<FusedComponent T>
+    using FusedStorageType = typename FusedStorage<T>::Type;
+}
+
+#endif
@@ -0,0 +1,247 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef GROUP_H
+#define GROUP_H
+
+#include <tuple>
+#include <span>
+#include "Pool.h"
+
+namespace vecs {
+    /**
+     * @brief List of components a group references without owning their pools
+     */
+    template<typename... Types>
+    struct Get {
+        explicit constexpr Get() = default;
+    };
+
+    template<typename... Types>
+    inline constexpr Get<Types...> get{};
+
+    template<typename GetList, typename... Owned>
+    class BasicGroup;
+
+    /**
+     * @brief Group over entities that have all Owned and all Referenced components
+     *
+     * Owning and partial-owning groups (at least one owned component) keep matching
+     * entities packed in the first size() slots of every owned pool's dense array, in
+     * identical order, so owned components are walked linearly and only referenced
+     * components need a sparse lookup. The packing is maintained through pool
+     * notifications, one swap per owned pool on every insert or remove.
+     * A pool can be owned by a single group at a time.
+     *
+     * Non-owning groups (no owned component) leave the pools untouched and instead
+     * keep a cached dense list of the matching entities. Like views, groups skip
+     * disabled entities.
+     */
+    template<typename... Referenced, typename... Owned>
+    class BasicGroup<Get<Referenced...>, Owned...> final : public PoolListener {
+        static_assert(sizeof...(Owned) + sizeof...(Referenced) > 0, "A group must have at least one component");
+
+        static constexpr bool isOwning = sizeof...(Owned) > 0;
+
+        using ComponentPools = std::tuple<Pool<Owned>*..., Pool<Referenced>*...>;
+        ComponentPools pools;
+        size_t length = 0;
+
+        // Cached matches of a non-owning group
+        std::vector<Entity> entities;
+        std::vector<size_t> positions;
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+        [[nodiscard]] bool matches(const Entity entity) const noexcept {
+            return (std::get<Pool<Owned>*>(pools)->isActive(entity) && ...) &&
+                   (std::get<Pool<Referenced>*>(pools)->isActive(entity) && ...);
+        }
+
+        void add(const Entity entity) {
+            if constexpr (isOwning) {
+                ((std::get<Pool<Owned>*>(pools)->swap(std::get<Pool<Owned>*>(pools)->index(entity), length)), ...);
+            } else {
+                const auto id = entity.getId();
+                if (id >= positions.size()) {
+                    positions.resize(std::max<size_t>(id + 1, positions.size() * 2), npos);
+                }
+                positions[id] = entities.size();
+                entities.push_back(entity);
+            }
+            ++length;
+        }
+
+        void remove(const Entity entity) noexcept {
+            --length;
+            if constexpr (isOwning) {
+                ((std::get<Pool<Owned>*>(pools)->swap(std::get<Pool<Owned>*>(pools)->index(entity), length)), ...);
+            } else {
+                const auto position = positions[entity.getId()];
+                const auto last = entities.back();
+                entities[position] = last;
+                positions[last.getId()] = position;
+                positions[entity.getId()] = npos;
+                entities.pop_back();
+            }
+        }
+
+        [[nodiscard]] const Entity* entityData() const noexcept {
+            if constexpr (isOwning) {
+                return std::get<0>(pools)->getEntities().data();
+            } else {
+                return entities.data();
+            }
+        }
+
+    public:
+        explicit BasicGroup(Pool<Owned>*... ownedPools, Pool<Referenced>*... referencedPools)
+            : pools(ownedPools..., referencedPools...) {
+            ((ownedPools->setOwner(this), ownedPools->addListener(this)), ...);
+            (referencedPools->addListener(this), ...);
+
+            if constexpr (isOwning) {
+                const auto& candidates = std::get<0>(pools)->getEntities();
+                for (size_t i = 0; i < candidates.size(); ++i) {
+                    if (matches(candidates[i])) {
+                        add(candidates[i]);
+                    }
+                }
+            } else {
+                std::span<const Entity> smallest = std::get<0>(pools)->getEntities();
+                ((smallest = referencedPools->size() < smallest.size()
+                    ? std::span<const Entity>(referencedPools->getEntities()) : smallest), ...);
+
+                for (const auto entity : smallest) {
+                    if (matches(entity)) {
+                        add(entity);
+                    }
+                }
+            }
+        }
+
+        BasicGroup(const BasicGroup&) = delete;
+        BasicGroup& operator=(const BasicGroup&) = delete;
+
+        void onInsert(const Entity entity) override {
+            if (!contains(entity) && matches(entity)) {
+                add(entity);
+            }
+        }
+
+        void onRemove(const Entity entity) override {
+            if (contains(entity)) {
+                remove(entity);
+            }
+        }
+
+        void onClear() override {
+            length = 0;
+            entities.clear();
+            positions.clear();
+        }
+
+        void onDisable(const Entity entity) override {
+            onRemove(entity);
+        }
+
+        void onEnable(const Entity entity) override {
+            onInsert(entity);
+        }
+
+        void onRemap(const std::span<const Entity> table) override {
+            if constexpr (!isOwning) {
+                std::ranges::fill(positions, npos);
+                for (size_t position = 0; position < entities.size(); ++position) {
+                    entities[position] = table[entities[position].getId()];
+                    positions[entities[position].getId()] = position;
+                }
+            }
+        }
+
+        [[nodiscard]] bool contains(const Entity entity) const noexcept {
+            if constexpr (isOwning) {
+                const auto* pool = std::get<0>(pools);
+                return pool->has(entity) && pool->index(entity) < length;
+            } else {
+                const auto id = entity.getId();
+                return id < positions.size() && positions[id] != npos && entities[positions[id]] == entity;
+            }
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return length; }
+        [[nodiscard]] bool empty() const noexcept { return length == 0; }
+
+        [[nodiscard]] std::span<const Entity> getEntities() const noexcept {
+            return std::span<const Entity>(entityData(), length);
+        }
+
+        [[nodiscard]] auto begin() const noexcept { return getEntities().begin(); }
+        [[nodiscard]] auto end() const noexcept { return getEntities().end(); }
+
+        /**
+         * @brief Gets a component of an entity without checking that it is present
+         */
+        template<typename T>
+        [[nodiscard]] T& get(const Entity entity) const noexcept {
+            return std::get<Pool<T>*>(pools)->get(entity);
+        }
+
+        /**
+         * @brief Iterates the group, passing owned components before referenced ones
+         */
+        template<typename Func>
+        void each(Func&& function) const {
+            const auto* data = entityData();
+            const auto owned = std::make_tuple(std::get<Pool<Owned>*>(pools)->getComponents().data()...);
+
+            if constexpr (std::is_invocable_v<Func, Entity, Owned&..., Referenced&...>) {
+                for (size_t i = 0; i < length; ++i) {
+                    function(data[i], std::get<Owned*>(owned)[i]...,
+                             std::get<Pool<Referenced>*>(pools)->get(data[i])...);
+                }
+            } else if constexpr (std::is_invocable_v<Func, Owned&..., Referenced&...>) {
+                for (size_t i = 0; i < length; ++i) {
+                    function(std::get<Owned*>(owned)[i]...,
+                             std::get<Pool<Referenced>*>(pools)->get(data[i])...);
+                }
+            } else if constexpr (std::is_invocable_v<Func, Entity>) {
+                for (size_t i = 0; i < length; ++i) {
+                    function(data[i]);
+                }
+            }
+        }
+
+        /**
+         * @brief Hands the packed entities and components to the callback as whole spans
+         *
+         * Only available when every component is owned, since referenced components are
+         * not contiguous.
+         */
+        template<typename Func>
+            requires (isOwning && sizeof...(Referenced) == 0)
+        void eachChunk(Func&& function) const {
+            if (length == 0) return;
+
+            function(getEntities(),
+                     std::span<Owned>(std::get<Pool<Owned>*>(pools)->getComponents()).first(length)...);
+        }
+    };
+
+    /**
+     * @brief Full-owning group over the specified components
+     */
+    template<typename... Owned>
+    using Group = BasicGroup<Get<>, Owned...>;
+
+    /**
+     * @brief Cached query over the specified components
+     *
+     * A non-owning group: the matching entities are kept in a dense list that is updated
+     * on every insert and remove, so iteration never recomputes the join and the pools
+     * keep their order.
+     */
+    template<typename... Components>
+    using Query = BasicGroup<Get<Components...>>;
+}
+
+#endif
@@ -0,0 +1,101 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef MEMORYSTATS_H
+#define MEMORYSTATS_H
+
+#include <cstddef>
+
+namespace vecs {
+    /**
+     * @brief Memory held by a storage, in bytes of allocated capacity
+     *
+     * Byte counts cover what the arrays have reserved, not only what is in use, so
+     * they match what the allocator handed out. Node-based containers are estimated.
+     */
+    struct MemoryStats {
+        // Arrays indexed by entity ID: sparse arrays, presence and flag bitsets
+        size_t sparseBytes = 0;
+        // Arrays of entities in storage order
+        size_t denseBytes = 0;
+        // Component values, including cold parts and shared values
+        size_t componentBytes = 0;
+        // Bookkeeping such as chunk metadata, reference counts and lookup tables
+        size_t metadataBytes = 0;
+
+        // Number of entities stored
+        size_t size = 0;
+        // Number of entities the dense arrays hold before they reallocate
+        size_t capacity = 0;
+        // Length of the arrays indexed by entity ID
+        size_t sparseSlots = 0;
+        // Slots of those arrays that map no stored entity
+        size_t emptySparseSlots = 0;
+
+        [[nodiscard]] constexpr size_t totalBytes() const noexcept {
+            return sparseBytes + denseBytes + componentBytes + metadataBytes;
+        }
+
+        /**
+         * @brief Gets the fraction of the dense capacity in use
+         */
+        [[nodiscard]] constexpr double loadFactor() const noexcept {
+            return capacity == 0 ? 0.0 : static_cast<double>(size) / static_cast<double>(capacity);
+        }
+
+        /**
+         * @brief Gets the fraction of sparse slots that map a stored entity
+         */
+        [[nodiscard]] constexpr double sparseOccupancy() const noexcept {
+            return sparseSlots == 0 ? 0.0 : static_cast<double>(sparseSlots - emptySparseSlots) / static_cast<double>(sparseSlots);
+        }
+
+        constexpr MemoryStats& operator+=(const MemoryStats& other) noexcept {
+            sparseBytes += other.sparseBytes;
+            denseBytes += other.denseBytes;
+            componentBytes += other.componentBytes;
+            metadataBytes += other.metadataBytes;
+            size += other.size;
+            capacity += other.capacity;
+            sparseSlots += other.sparseSlots;
+            emptySparseSlots += other.emptySparseSlots;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Memory held by the entity manager's bookkeeping, in bytes of allocated capacity
+     */
+    struct EntityMemoryStats {
+        size_t versionBytes = 0;
+        size_t validEntityBytes = 0;
+        size_t recycledIdBytes = 0;
+
+        // Number of live entities
+        size_t size = 0;
+        // Number of entity IDs with a version slot
+        size_t idSlots = 0;
+        // Number of destroyed IDs waiting to be reused
+        size_t recycled = 0;
+
+        [[nodiscard]] constexpr size_t totalBytes() const noexcept {
+            return versionBytes + validEntityBytes + recycledIdBytes;
+        }
+    };
+
+    /**
+     * @brief Memory held by a whole ECS
+     */
+    struct WorldMemoryStats {
+        // Every storage combined
+        MemoryStats pools;
+        EntityMemoryStats entities;
+        size_t poolCount = 0;
+
+        [[nodiscard]] constexpr size_t totalBytes() const noexcept {
+            return pools.totalBytes() + entities.totalBytes();
+        }
+    };
+}
+
+#endif
@@ -4,16 +4,147 @@
 #ifndef POOL_H
 #define POOL_H
 
+#include <stdexcept>
+#include <variant>
+
 #include "SparseSet.h"
+#include "StorageChunk.h"
 
 namespace vecs {
+    /**
+     * @brief Observer notified when entities enter or leave a pool
+     */
+    class PoolListener {
+    public:
+        virtual ~PoolListener() = default;
+        virtual void onInsert(Entity entity) = 0;
+        virtual void onRemove(Entity entity) = 0;
+        virtual void onClear() = 0;
+        // The entity left, or came back to, the enabled part of the pool
+        virtual void onDisable(Entity entity) = 0;
+        virtual void onEnable(Entity entity) = 0;
+        // Entities were renumbered; table maps old IDs to the new entities
+        virtual void onRemap(std::span<const Entity> table) = 0;
+    };
+
     class BasePool {
+        std::vector<PoolListener*> listeners;
+        PoolListener* owner = nullptr;
+        Tick tick = 1;
+
+    protected:
+        void notifyInsert(const Entity entity) const {
+            for (auto* listener : listeners) {
+                listener->onInsert(entity);
+            }
+        }
+
+        void notifyRemove(const Entity entity) const {
+            for (auto* listener : listeners) {
+                listener->onRemove(entity);
+            }
+        }
+
+        void notifyClear() const {
+            for (auto* listener : listeners) {
+                listener->onClear();
+            }
+        }
+
+        void notifyDisable(const Entity entity) const {
+            for (auto* listener : listeners) {
+                listener->onDisable(entity);
+            }
+        }
+
+        void notifyEnable(const Entity entity) const {
+            for (auto* listener : listeners) {
+                listener->onEnable(entity);
+            }
+        }
+
+        [[nodiscard]] bool hasListeners() const noexcept { return !listeners.empty(); }
+
     public:
         virtual ~BasePool() = default;
         virtual void removeEntity(Entity entity) = 0;
         [[nodiscard]] virtual size_t size() const = 0;
         virtual void clear() = 0;
         virtual void reserve(size_t capacity) = 0;
+
+        /**
+         * @brief Trims the pool's arrays to what its current entities need
+         */
+        virtual void shrinkToFit() = 0;
+
+        /**
+         * @brief Renumbers the pool's entities after an ID compaction
+         * @param table New entity for every old entity ID
+         */
+        virtual void remapEntities(std::span<const Entity> table) = 0;
+
+        /**
+         * @brief Gets a membership probe over the pool's current entities
+         *
+         * Lets type-erased code resolve a pool once and then test entities without
+         * further virtual calls.
+         */
+        [[nodiscard]] virtual EntityProbe probe() const noexcept = 0;
+
+        /**
+         * @brief Gets the memory the pool holds, see MemoryStats
+         */
+        [[nodiscard]] virtual MemoryStats memoryStats() const noexcept = 0;
+
+        /**
+         * @brief Moves an entity out of, or back into, the part of the pool views walk
+         *
+         * Storages without a dense entity array, such as flag and state pools, keep
+         * disabled entities as they are.
+         */
+        virtual void disable(Entity) {}
+        virtual void enable(Entity) {}
+
+        /**
+         * @brief Moves the pool a bounded step towards ascending entity ID order
+         * @param budget Maximum number of entity IDs to visit
+         * @return Number of entity IDs visited, 0 once the pool is in order or cannot be reordered
+         */
+        virtual size_t defragment(size_t) { return 0; }
+
+        void addListener(PoolListener* listener) { listeners.push_back(listener); }
+
+        /**
+         * @brief Gets the group that controls the order of this pool's dense array
+         * @return Owning listener or nullptr if the pool is not owned
+         */
+        [[nodiscard]] PoolListener* getOwner() const noexcept { return owner; }
+        void setOwner(PoolListener* listener) noexcept { owner = listener; }
+
+        /**
+         * @brief Gets the tick stamped on chunks changed from now on
+         */
+        [[nodiscard]] Tick getTick() const noexcept { return tick; }
+        void setTick(const Tick current) noexcept { tick = current; }
+    };
+
+    /**
+     * @brief Component that declares a rarely read part through a nested Cold type
+     *
+     * struct Unit { float health; Vec2 target; using Cold = UnitConfig; };
+     * The pool keeps Unit densely for views and Unit::Cold in a parallel array.
+     */
+    template<typename T>
+    concept SplitComponent = requires { typename T::Cold; };
+
+    template<typename T>
+    struct ColdStorageOf {
+        using Type = std::monostate;
+    };
+
+    template<SplitComponent T>
+    struct ColdStorageOf<T> {
+        using Type = std::vector<typename T::Cold>;
     };
 
     template<typename T, typename Allocator = DefaultAllocator<T>>
@@ -21,16 +152,151 @@ namespace vecs {
         using SparseSetType = SparseSet<T, Allocator>;
         SparseSetType components;
 
+        // Cold parts of split components, index-aligned with the dense array
+        [[no_unique_address]] typename ColdStorageOf<T>::Type cold;
+
+        struct ChunkMetadata {
+            Tick changeTick = 0;
+            // Bounds are cached by mutable chunk iteration and dropped when the chunk changes
+            bool boundsValid = false;
+            ChunkBoundsType<T> bounds{};
+        };
+        static constexpr bool tracksChunks = ChunkTrackedComponent<T>;
+        [[no_unique_address]] std::conditional_t<tracksChunks, std::vector<ChunkMetadata>, std::monostate> chunks;
+
+        // Progress of an incremental defragment pass
+        struct DefragCursor {
+            size_t id = 0;
+            size_t activeSlot = 0;
+            size_t disabledSlot = 0;
+        } defragCursor;
+
+        void stamp(ChunkMetadata& chunk) const noexcept {
+            chunk.changeTick = getTick();
+            chunk.boundsValid = false;
+        }
+
+        void touch(const size_t index) {
+            if constexpr (tracksChunks) {
+                const auto chunk = index / chunkCapacity;
+                if (chunk >= chunks.size()) {
+                    chunks.resize(chunk + 1);
+                }
+                stamp(chunks[chunk]);
+            }
+        }
+
+        // Mirrors a swap of the sparse set into the cold array and chunk metadata
+        void swapped(const size_t lhs, const size_t rhs) {
+            if (lhs == rhs) return;
+
+            if constexpr (SplitComponent<T>) std::swap(cold[lhs], cold[rhs]);
+            touch(lhs);
+            touch(rhs);
+        }
+
+        // New entities are appended, then swapped in front of the disabled ones
+        void appended(const Entity entity) {
+            if constexpr (SplitComponent<T>) cold.emplace_back();
+            touch(size() - 1);
+            swapped(components.index(entity), size() - 1);
+        }
+
+        void touchAll() {
+            if constexpr (tracksChunks) {
+                chunks.resize(chunkCount());
+                for (auto& chunk : chunks) {
+                    stamp(chunk);
+                }
+            }
+        }
+
+        // Mirrors a reordering of the sparse set into the cold array and chunk metadata
+        void reordered(const std::span<const size_t> order) {
+            if constexpr (SplitComponent<T>) {
+                typename ColdStorageOf<T>::Type sorted;
+                sorted.reserve(cold.size());
+                for (const auto index : order) {
+                    sorted.push_back(std::move(cold[index]));
+                }
+                cold = std::move(sorted);
+            }
+            touchAll();
+        }
+
+        // Owning groups keep their entities packed at the front, which a sort would scatter
+        void checkUnowned() const {
+            if (getOwner()) {
+                throw std::runtime_error("Cannot reorder a pool owned by a group");
+            }
+        }
+
+        [[nodiscard]] bool partitionsSorted() const noexcept {
+            const auto& dense = components.getEntities();
+            const auto split = dense.begin() + static_cast<std::ptrdiff_t>(activeSize());
+            return std::ranges::is_sorted(dense.begin(), split, {}, &Entity::getId) &&
+                   std::ranges::is_sorted(split, dense.end(), {}, &Entity::getId);
+        }
+
+        template<typename Value>
+        [[nodiscard]] StorageChunk<Value> makeChunk(const size_t index, std::span<Value> values) const {
+            const auto offset = index * chunkCapacity;
+            const auto count = std::min(chunkCapacity, activeSize() - offset);
+            const auto& metadata = chunks[index];
+
+            StorageChunk<Value> chunk{
+                std::span<const Entity>(getEntities()).subspan(offset, count),
+                values.subspan(offset, count),
+                metadata.changeTick
+            };
+            if constexpr (BoundedComponent<T>) {
+                // Const readers may run concurrently, so stale bounds are computed here and not cached
+                chunk.bounds = metadata.boundsValid
+                                   ? metadata.bounds
+                                   : ChunkBounds<T>::compute(std::span<const T>(chunk.components));
+            }
+            return chunk;
+        }
+
+        void refreshBounds(const size_t index) {
+            if constexpr (BoundedComponent<T>) {
+                const auto offset = index * chunkCapacity;
+                const auto count = std::min(chunkCapacity, activeSize() - offset);
+                chunks[index].bounds = ChunkBounds<T>::compute(std::span<const T>(getComponents()).subspan(offset, count));
+                chunks[index].boundsValid = true;
+            }
+        }
+
     public:
+        static constexpr size_t chunkCapacity = storageChunkCapacity<T>;
+
         Pool() = default;
 
+        /**
+         * @param initialCapacity Components to reserve room for; 0 allocates nothing until the first insert
+         */
+        explicit Pool(const size_t initialCapacity) : components(initialCapacity) {}
+
         void insert(Entity entity, T&& component) {
+            const auto count = components.size();
             components.insert(entity, std::forward<T>(component));
+            if (components.size() != count) {
+                appended(entity);
+                notifyInsert(entity);
+            }
         }
 
         template<typename... Args>
         T& emplace(Entity entity, Args&&... args) {
-            return components.emplace(entity, std::forward<Args>(args)...);
+            const auto count = components.size();
+            auto& component = components.emplace(entity, std::forward<Args>(args)...);
+            if (components.size() == count) return component;
+
+            appended(entity);
+            if (!hasListeners()) return component;
+
+            notifyInsert(entity);
+            return components.get(entity);
         }
 
         [[nodiscard]] inline T& get(Entity entity) noexcept {
@@ -45,12 +311,83 @@ namespace vecs {
             return components.contains(entity);
         }
 
+        [[nodiscard]] EntityProbe probe() const noexcept override {
+            return components.probe();
+        }
+
+        [[nodiscard]] inline bool isEntitySorted() const noexcept {
+            return components.isEntitySorted();
+        }
+
+        void trackPresence(const bool enabled) {
+            components.trackPresence(enabled);
+        }
+
+        [[nodiscard]] inline bool tracksPresence() const noexcept {
+            return components.tracksPresence();
+        }
+
+        inline void prefetchSparse(Entity entity) const noexcept {
+            components.prefetchSparse(entity);
+        }
+
+        inline void prefetchComponent(Entity entity) const noexcept {
+            components.prefetchComponent(entity);
+        }
+
         void removeEntity(Entity entity) override {
+            if (!components.contains(entity)) return;
+
+            if (hasListeners()) {
+                notifyRemove(entity);
+            }
+            // Same slot moves as SparseSet::remove, mirrored into the cold array
+            auto index = components.index(entity);
+            if (index < activeSize() && activeSize() != size()) {
+                swapped(index, activeSize() - 1);
+                index = activeSize() - 1;
+            }
+            touch(index);
+            touch(size() - 1);
+            if constexpr (SplitComponent<T>) {
+                cold[index] = std::move(cold.back());
+                cold.pop_back();
+            }
             components.remove(entity);
+            if constexpr (tracksChunks) chunks.resize(chunkCount());
+        }
+
+        void disable(const Entity entity) override {
+            if (!isActive(entity)) return;
+
+            const auto index = components.index(entity);
+            components.disable(entity);
+            swapped(index, activeSize());
+            notifyDisable(entity);
+        }
+
+        void enable(const Entity entity) override {
+            if (!has(entity) || isActive(entity)) return;
+
+            const auto index = components.index(entity);
+            components.enable(entity);
+            swapped(index, activeSize() - 1);
+            notifyEnable(entity);
+        }
+
+        [[nodiscard]] inline bool isActive(const Entity entity) const noexcept {
+            return components.isActive(entity);
+        }
+
+        [[nodiscard]] inline size_t activeSize() const noexcept {
+            return components.activeSize();
         }
 
         void clear() override {
             components.clear();
+            if constexpr (tracksChunks) chunks.clear();
+            if constexpr (SplitComponent<T>) cold.clear();
+            notifyClear();
         }
 
         [[nodiscard]] size_t size() const override {
@@ -61,9 +398,170 @@ namespace vecs {
             components.reserve(capacity);
         }
 
+        void remapEntities(const std::span<const Entity> table) override {
+            components.remap(table);
+            touchAll();
+        }
+
+        void shrinkToFit() override {
+            components.shrinkToFit();
+            if constexpr (SplitComponent<T>) cold.shrink_to_fit();
+            if constexpr (tracksChunks) {
+                chunks.resize(chunkCount());
+                chunks.shrink_to_fit();
+            }
+        }
+
+        [[nodiscard]] MemoryStats memoryStats() const noexcept override {
+            auto stats = components.memoryStats();
+            if constexpr (SplitComponent<T>) {
+                stats.componentBytes += cold.capacity() * sizeof(typename ColdStorageOf<T>::Type::value_type);
+            }
+            if constexpr (tracksChunks) stats.metadataBytes += chunks.capacity() * sizeof(ChunkMetadata);
+            return stats;
+        }
+
+        [[nodiscard]] inline size_t index(Entity entity) const noexcept {
+            return components.index(entity);
+        }
+
+        void swap(const size_t lhs, const size_t rhs) noexcept {
+            if (lhs == rhs) return;
+
+            components.swap(lhs, rhs);
+            if constexpr (SplitComponent<T>) std::swap(cold[lhs], cold[rhs]);
+            if constexpr (tracksChunks) {
+                stamp(chunks[lhs / chunkCapacity]);
+                stamp(chunks[rhs / chunkCapacity]);
+            }
+        }
+
+        /**
+         * @brief Sorts the pool by component
+         * @throws std::runtime_error if the pool is owned by a group
+         */
         template<typename Compare>
         void sort(Compare compare) {
-            components.sort(std::move(compare));
+            checkUnowned();
+            components.sort(std::move(compare), [this](const std::span<const size_t> order) {
+                reordered(order);
+            });
+        }
+
+        /**
+         * @brief Restores ascending entity ID order in one go with a radix sort
+         *
+         * Enabled and disabled entities are each put in order within their own partition.
+         * @throws std::runtime_error if the pool is owned by a group
+         */
+        void sortByEntity() {
+            checkUnowned();
+            components.sortByEntity([this](const std::span<const size_t> order) {
+                reordered(order);
+            });
+        }
+
+        /**
+         * @brief Incrementally restores ascending entity ID order
+         *
+         * Walks the sparse array from where the previous call stopped and swaps every
+         * entity found into the next slot of its partition, so a full pass leaves the
+         * pool in ID order. Changes made to the pool between calls may leave the pass
+         * unsorted, in which case the next pass starts over. Owned pools are skipped since
+         * their order belongs to their group.
+         */
+        size_t defragment(const size_t budget) override {
+            if (getOwner() || isEntitySorted()) {
+                defragCursor = {};
+                return 0;
+            }
+            // With disabled entities the dense array as a whole is never in ID order,
+            // so a new pass only starts when one of the partitions is not
+            if (defragCursor.id == 0 && activeSize() != size() && partitionsSorted()) return 0;
+            // Enabling or disabling entities mid-pass moves the partition boundary
+            defragCursor.disabledSlot = std::max(defragCursor.disabledSlot, activeSize());
+
+            const auto end = components.sparseSize();
+            size_t visited = 0;
+            while (visited < budget && defragCursor.id < end) {
+                const auto index = components.find(static_cast<EntityId>(defragCursor.id++));
+                ++visited;
+                if (index < activeSize()) {
+                    if (index >= defragCursor.activeSlot) swap(index, defragCursor.activeSlot++);
+                } else if (index < size() && index >= defragCursor.disabledSlot) {
+                    swap(index, defragCursor.disabledSlot++);
+                }
+            }
+
+            if (defragCursor.id >= end) {
+                defragCursor = {};
+                components.refreshEntitySorted();
+            }
+            return visited;
+        }
+
+        /**
+         * @brief Gets the cold part of an entity's component without checking that it is present
+         */
+        [[nodiscard]] auto& getCold(const Entity entity) noexcept requires SplitComponent<T> {
+            return cold[components.index(entity)];
+        }
+
+        [[nodiscard]] const auto& getCold(const Entity entity) const noexcept requires SplitComponent<T> {
+            return cold[components.index(entity)];
+        }
+
+        [[nodiscard]] const auto& getColdComponents() const noexcept requires SplitComponent<T> { return cold; }
+        [[nodiscard]] auto& getColdComponents() noexcept requires SplitComponent<T> { return cold; }
+
+        /**
+         * @brief Stamps the chunk holding an entity's component as changed
+         *
+         * Writes through references are not tracked; call this after modifying a
+         * component outside of a mutable chunk iteration. Does nothing unless T is
+         * chunk-tracked, see TrackChunks.
+         */
+        void markChanged(const Entity entity) {
+            if (components.contains(entity)) {
+                touch(components.index(entity));
+            }
+        }
+
+        [[nodiscard]] size_t chunkCount() const noexcept {
+            return (size() + chunkCapacity - 1) / chunkCapacity;
+        }
+
+        [[nodiscard]] size_t activeChunkCount() const noexcept {
+            return (activeSize() + chunkCapacity - 1) / chunkCapacity;
+        }
+
+        /**
+         * @brief Walks the enabled part of the dense arrays in chunks of chunkCapacity components
+         * @param since Chunks whose change tick is not newer than this are skipped
+         *
+         * Handing out mutable components stamps each visited chunk with the current tick
+         * and recomputes its bounds afterwards, so later readers find them cached.
+         */
+        template<typename Func> requires tracksChunks
+        void eachChunk(Func&& function, const Tick since = 0) {
+            const std::span<T> values(getComponents());
+            for (size_t index = 0; index < activeChunkCount(); ++index) {
+                if (chunks[index].changeTick <= since) continue;
+
+                function(makeChunk(index, values));
+                stamp(chunks[index]);
+                refreshBounds(index);
+            }
+        }
+
+        template<typename Func> requires tracksChunks
+        void eachChunk(Func&& function, const Tick since = 0) const {
+            const std::span<const T> values(getComponents());
+            for (size_t index = 0; index < activeChunkCount(); ++index) {
+                if (chunks[index].changeTick <= since) continue;
+
+                function(makeChunk(index, values));
+            }
         }
 
         [[nodiscard]] const auto& getSparseSet() const noexcept { return components; }
@@ -79,6 +577,12 @@ namespace vecs {
         [[nodiscard]] auto cbegin() const noexcept { return components.cbegin(); }
         [[nodiscard]] auto cend() const noexcept { return components.cend(); }
     };
+
+    /**
+     * @brief Pool type used to access T, read-only when T is const-qualified
+     */
+    template<typename T>
+    using PoolFor = std::conditional_t<std::is_const_v<T>, const Pool<std::remove_const_t<T>>, Pool<T>>;
 }
 
 #endif
\ No newline at end of file
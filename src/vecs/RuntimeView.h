@@ -0,0 +1,98 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef RUNTIMEVIEW_H
+#define RUNTIMEVIEW_H
+
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <vector>
+#include "Pool.h"
+
+namespace vecs {
+    /**
+     * @brief View over pools chosen at runtime, for scripting and tooling
+     *
+     * Each iteration resolves one EntityProbe per pool through a single virtual call,
+     * walks the smallest pool and tests the others in ascending size order, so the
+     * per-entity work matches a compiled View. Only entities are yielded; components
+     * are accessed through the caller's own pool bindings.
+     * Components must not be added or removed while iterating.
+     */
+    class RuntimeView {
+        std::vector<const BasePool*> pools;
+
+        [[nodiscard]] std::vector<EntityProbe> resolveProbes() const {
+            std::vector<EntityProbe> probes;
+            if (pools.empty() || std::ranges::find(pools, nullptr) != pools.end()) {
+                return probes;
+            }
+
+            probes.reserve(pools.size());
+            for (const auto* pool : pools) {
+                probes.push_back(pool->probe());
+            }
+            // Membership-only probes, such as flag pools, cannot be walked
+            std::ranges::sort(probes, std::less{}, [](const EntityProbe& probe) {
+                return probe.hasEntities() ? probe.size() : std::numeric_limits<size_t>::max();
+            });
+            if (!probes.front().hasEntities()) probes.clear();
+            return probes;
+        }
+
+    public:
+        RuntimeView() = default;
+
+        /**
+         * @param componentPools Pools an entity must belong to; a null pool makes the view empty
+         */
+        explicit RuntimeView(std::vector<const BasePool*> componentPools) noexcept
+            : pools(std::move(componentPools)) {}
+
+        /**
+         * @brief Adds a pool the matching entities must belong to
+         */
+        RuntimeView& iterate(const BasePool* pool) {
+            pools.push_back(pool);
+            return *this;
+        }
+
+        [[nodiscard]] bool contains(const Entity entity) const noexcept {
+            if (pools.empty()) return false;
+
+            return std::ranges::all_of(pools, [entity](const BasePool* pool) {
+                return pool && pool->probe().contains(entity);
+            });
+        }
+
+        template<typename Func>
+        void each(Func&& function) const {
+            const auto probes = resolveProbes();
+            if (probes.empty()) return;
+
+            const auto others = std::span<const EntityProbe>(probes).subspan(1);
+            for (const auto entity : probes.front().getEntities()) {
+                if (std::ranges::all_of(others, [entity](const EntityProbe& probe) { return probe.contains(entity); })) {
+                    function(entity);
+                }
+            }
+        }
+
+        [[nodiscard]] size_t count() const {
+            size_t total = 0;
+            each([&total](Entity) { ++total; });
+            return total;
+        }
+
+        /**
+         * @brief Upper bound on the number of matching entities
+         */
+        [[nodiscard]] size_t sizeHint() const {
+            const auto probes = resolveProbes();
+            return probes.empty() ? 0 : probes.front().size();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,207 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef SHAREDPOOL_H
+#define SHAREDPOOL_H
+
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Pool.h"
+
+namespace vecs {
+    template<typename T>
+    concept ShareableComponent = std::equality_comparable<T> && requires(const T& value) {
+        { std::hash<T>{}(value) } -> std::convertible_to<size_t>;
+    };
+
+    /**
+     * @brief Flyweight storage keeping each distinct value of T once
+     *
+     * Meant for read-mostly components many entities have in common, such as mesh or
+     * material references. Values are deduplicated through std::hash<T> and operator==,
+     * and every entity's dense slot only holds a 32-bit handle into the value table.
+     * Unused values are released once their last entity lets go of them.
+     */
+    template<ShareableComponent T>
+    class SharedPool final : public BasePool {
+        using Handle = std::uint32_t;
+
+        SparseSet<Handle> handles;
+        // Released slots are emptied so resources held by a value go with its last entity
+        std::vector<std::optional<T>> values;
+        std::vector<size_t> references;
+        std::vector<Handle> freeHandles;
+        // Hash of a value to the handles holding values with that hash
+        std::unordered_multimap<size_t, Handle> lookup;
+
+        [[nodiscard]] Handle acquire(const T& value) {
+            const auto hash = std::hash<T>{}(value);
+            const auto [first, last] = lookup.equal_range(hash);
+            for (auto it = first; it != last; ++it) {
+                if (*values[it->second] == value) {
+                    ++references[it->second];
+                    return it->second;
+                }
+            }
+
+            Handle handle;
+            if (!freeHandles.empty()) {
+                handle = freeHandles.back();
+                freeHandles.pop_back();
+                values[handle].emplace(value);
+                references[handle] = 1;
+            } else {
+                handle = static_cast<Handle>(values.size());
+                values.emplace_back(value);
+                references.push_back(1);
+            }
+            lookup.emplace(hash, handle);
+            return handle;
+        }
+
+        void release(const Handle handle) {
+            if (--references[handle] != 0) return;
+
+            const auto [first, last] = lookup.equal_range(std::hash<T>{}(*values[handle]));
+            for (auto it = first; it != last; ++it) {
+                if (it->second == handle) {
+                    lookup.erase(it);
+                    break;
+                }
+            }
+            values[handle].reset();
+            freeHandles.push_back(handle);
+        }
+
+    public:
+        SharedPool() = default;
+        explicit SharedPool(const size_t initialCapacity) : handles(initialCapacity) {}
+
+        /**
+         * @brief Assigns a value to an entity, replacing the one it shared before
+         * @return The shared instance equal to value
+         */
+        const T& insert(const Entity entity, const T& value) {
+            const auto handle = acquire(value);
+            if (handles.contains(entity)) {
+                release(std::exchange(handles.get(entity), handle));
+                return *values[handle];
+            }
+
+            try {
+                handles.insert(entity, Handle{handle});
+            } catch (...) {
+                release(handle);
+                throw;
+            }
+            notifyInsert(entity);
+            return *values[handle];
+        }
+
+        [[nodiscard]] inline const T& get(const Entity entity) const noexcept {
+            return *values[handles.get(entity)];
+        }
+
+        [[nodiscard]] inline bool has(const Entity entity) const noexcept {
+            return handles.contains(entity);
+        }
+
+        /**
+         * @brief Gets the number of entities referencing the same value as entity
+         */
+        [[nodiscard]] size_t useCount(const Entity entity) const noexcept {
+            return handles.contains(entity) ? references[handles.get(entity)] : 0;
+        }
+
+        /**
+         * @brief Gets the number of distinct values currently stored
+         */
+        [[nodiscard]] size_t uniqueCount() const noexcept {
+            return values.size() - freeHandles.size();
+        }
+
+        void removeEntity(const Entity entity) override {
+            if (!handles.contains(entity)) return;
+
+            notifyRemove(entity);
+            release(handles.get(entity));
+            handles.remove(entity);
+        }
+
+        void disable(const Entity entity) override {
+            handles.disable(entity);
+        }
+
+        void enable(const Entity entity) override {
+            handles.enable(entity);
+        }
+
+        [[nodiscard]] size_t size() const override {
+            return handles.size();
+        }
+
+        void clear() override {
+            handles.clear();
+            values.clear();
+            references.clear();
+            freeHandles.clear();
+            lookup.clear();
+            notifyClear();
+        }
+
+        void reserve(const size_t capacity) override {
+            handles.reserve(capacity);
+        }
+
+        void remapEntities(const std::span<const Entity> table) override {
+            handles.remap(table);
+        }
+
+        /**
+         * @brief Trims the handle arrays and drops released values from the end of the table
+         */
+        void shrinkToFit() override {
+            handles.shrinkToFit();
+
+            std::ranges::sort(freeHandles);
+            while (!freeHandles.empty() && freeHandles.back() == values.size() - 1) {
+                freeHandles.pop_back();
+                values.pop_back();
+                references.pop_back();
+            }
+            values.shrink_to_fit();
+            references.shrink_to_fit();
+            freeHandles.shrink_to_fit();
+            lookup.rehash(0);
+        }
+
+        [[nodiscard]] EntityProbe probe() const noexcept override {
+            return handles.probe();
+        }
+
+        /**
+         * @brief Gets the memory held by the pool, with the value table as component bytes
+         *
+         * The per-entity handles count as dense bytes. The lookup table is estimated
+         * from its buckets and nodes.
+         */
+        [[nodiscard]] MemoryStats memoryStats() const noexcept override {
+            auto stats = handles.memoryStats();
+            stats.denseBytes += std::exchange(stats.componentBytes, values.capacity() * sizeof(std::optional<T>));
+            stats.metadataBytes += references.capacity() * sizeof(size_t) +
+                                   freeHandles.capacity() * sizeof(Handle) +
+                                   lookup.bucket_count() * sizeof(void*) +
+                                   lookup.size() * (sizeof(typename decltype(lookup)::value_type) + 2 * sizeof(void*));
+            return stats;
+        }
+
+        [[nodiscard]] const auto& getEntities() const noexcept { return handles.getEntities(); }
+    };
+}
+
+#endif
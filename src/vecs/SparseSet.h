@@ -6,10 +6,23 @@
 
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <numeric>
+#include <span>
 
 #include "Entity.h"
 
+#if defined(__GNUC__) || defined(__clang__)
+#define VECS_PREFETCH(address) __builtin_prefetch(address)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define VECS_PREFETCH(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+#define VECS_PREFETCH(address) ((void)(address))
+#endif
+
 namespace vecs {
     template<typename T>
     class DefaultAllocator : public std::allocator<T> {
@@ -19,13 +32,123 @@ namespace vecs {
         struct rebind { using other = DefaultAllocator<U>; };
     };
 
+    using PresenceWord = std::uint64_t;
+    inline constexpr size_t presenceWordBits = 64;
+
+    /**
+     * @brief Membership test over the sparse and dense arrays of a sparse set
+     *
+     * Independent of the component type, so probes of different pools can be stored
+     * together and reordered at runtime. Invalidated when entities are added to or
+     * removed from the set. Storages without a dense entity list, such as flag pools,
+     * provide membership-only probes that test a presence bit per entity ID.
+     */
+    class EntityProbe {
+        const Entity* sparse = nullptr;
+        const Entity* dense = nullptr;
+        const PresenceWord* presence = nullptr;
+        size_t sparseSize = 0;
+        size_t denseSize = 0;
+        size_t presenceSize = 0;
+        bool entitySorted = false;
+        bool presenceTracked = false;
+        bool membershipOnly = false;
+
+    public:
+        EntityProbe() noexcept = default;
+
+        EntityProbe(const std::span<const Entity> sparseEntities, const std::span<const Entity> denseEntities,
+                    const bool sorted = false) noexcept
+            : sparse(sparseEntities.data()), dense(denseEntities.data()),
+              sparseSize(sparseEntities.size()), denseSize(denseEntities.size()), entitySorted(sorted) {}
+
+        EntityProbe(const std::span<const Entity> sparseEntities, const std::span<const Entity> denseEntities,
+                    const bool sorted, const std::span<const PresenceWord> presenceWords) noexcept
+            : EntityProbe(sparseEntities, denseEntities, sorted) {
+            presence = presenceWords.data();
+            presenceSize = presenceWords.size();
+            presenceTracked = true;
+        }
+
+        /**
+         * @brief Creates a probe over a presence bitset alone
+         * @param count Number of set bits, reported as size()
+         */
+        [[nodiscard]] static EntityProbe membership(const std::span<const PresenceWord> presenceWords,
+                                                    const size_t count) noexcept {
+            EntityProbe probe{{}, {}, false, presenceWords};
+            probe.denseSize = count;
+            probe.membershipOnly = true;
+            return probe;
+        }
+
+        [[nodiscard]] inline bool contains(const Entity entity) const noexcept {
+            const auto id = entity.getId();
+            if (membershipOnly) [[unlikely]] {
+                return id / presenceWordBits < presenceSize &&
+                       (presence[id / presenceWordBits] >> (id % presenceWordBits) & 1) != 0;
+            }
+            return id < sparseSize &&
+                   sparse[id].getId() < denseSize &&
+                   dense[sparse[id].getId()] == entity;
+        }
+
+        /**
+         * @brief Finds the first dense slot at or after from whose entity ID is not below id
+         *
+         * Gallops forward from the cursor, then binary searches the last step, so a walk
+         * over ascending IDs costs O(log gap) per call. Only meaningful on entity-sorted sets.
+         * @return Dense index, or size() if every remaining entity has a lower ID
+         */
+        [[nodiscard]] size_t seek(const size_t from, const EntityId id) const noexcept {
+            size_t low = from;
+            size_t high = from;
+            for (size_t step = 1; high < denseSize && dense[high].getId() < id; step *= 2) {
+                low = high + 1;
+                high += step;
+            }
+
+            const auto* first = std::lower_bound(dense + low, dense + std::min(high, denseSize), id,
+                [](const Entity entity, const EntityId value) { return entity.getId() < value; });
+            return static_cast<size_t>(first - dense);
+        }
+
+        /**
+         * @brief Gets the stored entity whose ID is id, which must be present
+         */
+        [[nodiscard]] const Entity& find(const EntityId id) const noexcept { return dense[sparse[id].getId()]; }
+
+        [[nodiscard]] const Entity& at(const size_t index) const noexcept { return dense[index]; }
+        [[nodiscard]] constexpr size_t size() const noexcept { return denseSize; }
+        [[nodiscard]] constexpr bool isEntitySorted() const noexcept { return entitySorted; }
+        [[nodiscard]] constexpr bool tracksPresence() const noexcept { return presenceTracked; }
+        [[nodiscard]] constexpr bool hasEntities() const noexcept { return !membershipOnly; }
+
+        /**
+         * @brief Checks if both probes were taken from the same storage
+         */
+        [[nodiscard]] bool sameSource(const EntityProbe& other) const noexcept {
+            return sparse == other.sparse && dense == other.dense && presence == other.presence;
+        }
+        [[nodiscard]] std::span<const Entity> getEntities() const noexcept {
+            return membershipOnly ? std::span<const Entity>{} : std::span<const Entity>{dense, denseSize};
+        }
+        [[nodiscard]] std::span<const PresenceWord> getPresence() const noexcept { return {presence, presenceSize}; }
+    };
+
     template<typename T, typename Allocator = DefaultAllocator<T>>
     class SparseSet {
         using EntityAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>;
+        using PresenceAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<PresenceWord>;
 
         std::vector<Entity, EntityAllocator> sparse;
         std::vector<Entity, EntityAllocator> dense;
         std::vector<T, Allocator> components;
+        std::vector<PresenceWord, PresenceAllocator> presence;
+        // Dense slots from activeCount on hold disabled entities
+        size_t activeCount = 0;
+        bool entitySorted = true;
+        bool presenceTracked = false;
 
         static constexpr size_t initialSize = 8192;
         static constexpr size_t pageSize = 4096;
@@ -50,10 +173,68 @@ namespace vecs {
             components.reserve(aligned);
         }
 
+        void markPresent(const EntityId id) {
+            if (!presenceTracked) return;
+
+            if (const auto word = id / presenceWordBits; word >= presence.size()) {
+                presence.resize(std::max(word + 1, (sparse.size() + presenceWordBits - 1) / presenceWordBits), 0);
+            }
+            presence[id / presenceWordBits] |= PresenceWord{1} << (id % presenceWordBits);
+        }
+
+        void markAbsent(const EntityId id) noexcept {
+            if (presenceTracked && id / presenceWordBits < presence.size()) {
+                presence[id / presenceWordBits] &= ~(PresenceWord{1} << (id % presenceWordBits));
+            }
+        }
+
+        // LSD radix sort of dense slots by entity ID, one byte per pass, skipping the
+        // passes above the highest ID
+        void radixSortById(const std::span<size_t> indices, std::vector<size_t>& buffer) const {
+            if (indices.size() <= 1) return;
+
+            EntityId maxId = 0;
+            for (const auto index : indices) maxId = std::max(maxId, dense[index].getId());
+
+            const auto scratch = std::span(buffer).first(indices.size());
+            for (int shift = 0; shift < static_cast<int>(std::bit_width(maxId)); shift += 8) {
+                std::array<size_t, 257> offsets{};
+                for (const auto index : indices) ++offsets[(dense[index].getId() >> shift & 0xFF) + 1];
+                std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+                for (const auto index : indices) scratch[offsets[dense[index].getId() >> shift & 0xFF]++] = index;
+                std::ranges::copy(scratch, indices.begin());
+            }
+        }
+
+        // Moves every slot to its position in indices and hands the order to permute
+        template<typename Permute>
+        void reorder(const std::vector<size_t>& indices, Permute& permute) {
+            std::vector<T, Allocator> sortedComponents;
+            std::vector<Entity, EntityAllocator> sortedDense;
+            sortedComponents.reserve(components.size());
+            sortedDense.reserve(dense.size());
+
+            for (auto idx : indices) {
+                sortedComponents.push_back(std::move(components[idx]));
+                sortedDense.push_back(dense[idx]);
+                sparse[dense[idx].getId()] = Entity{static_cast<EntityId>(sortedDense.size() - 1)};
+            }
+
+            components = std::move(sortedComponents);
+            dense = std::move(sortedDense);
+            entitySorted = std::ranges::is_sorted(dense, {}, &Entity::getId);
+            permute(std::span<const size_t>(indices));
+        }
+
     public:
-        SparseSet() {
-            reserveAndAlignStorage(initialSize);
-            sparse.resize(initialSize, Entity::null());
+        /**
+         * @param initialCapacity Entities to reserve room for; 0 allocates nothing until the first insert
+         */
+        explicit SparseSet(const size_t initialCapacity = initialSize) {
+            if (initialCapacity == 0) return;
+
+            reserveAndAlignStorage(initialCapacity);
+            sparse.resize(roundUpPow2(initialCapacity), Entity::null());
         }
 
         [[nodiscard]] inline bool contains(Entity entity) const noexcept {
@@ -63,6 +244,30 @@ namespace vecs {
                    dense[sparse[id].getId()] == entity;
         }
 
+        /**
+         * @brief Prefetches the sparse slot of an entity
+         */
+        inline void prefetchSparse(const Entity entity) const noexcept {
+            if (const auto id = entity.getId(); id < sparse.size()) {
+                VECS_PREFETCH(sparse.data() + id);
+            }
+        }
+
+        /**
+         * @brief Prefetches the dense and component slots of an entity
+         *
+         * Reads the sparse slot, so it pays off once prefetchSparse() has been issued
+         * for the same entity a few iterations earlier.
+         */
+        inline void prefetchComponent(const Entity entity) const noexcept {
+            if (const auto id = entity.getId(); id < sparse.size()) {
+                if (const auto index = sparse[id].getId(); index < dense.size()) {
+                    VECS_PREFETCH(dense.data() + index);
+                    VECS_PREFETCH(components.data() + index);
+                }
+            }
+        }
+
         [[nodiscard]] inline T& get(const Entity entity) noexcept {
             return components[sparse[entity.getId()].getId()];
         }
@@ -79,15 +284,18 @@ namespace vecs {
                 sparse.resize(newSize, Entity::null());
 
                 if (dense.size() >= dense.capacity() / 2) {
-                    reserveAndAlignStorage(dense.capacity() * growthFactor);
+                    reserveAndAlignStorage(std::max<size_t>(dense.capacity() * growthFactor, 1));
                 }
             }
 
             if (!contains(entity)) {
                 const auto pos = dense.size();
+                entitySorted = entitySorted && (dense.empty() || dense.back().getId() < entityId);
+                markPresent(entityId);
                 sparse[entityId] = Entity{static_cast<EntityId>(pos)};
                 dense.push_back(entity);
                 components.push_back(std::forward<T>(component));
+                activate(pos);
             }
         }
 
@@ -100,15 +308,18 @@ namespace vecs {
                 sparse.resize(newSize, Entity::null());
 
                 if (dense.size() >= dense.capacity() / 2) {
-                    reserveAndAlignStorage(dense.capacity() * growthFactor);
+                    reserveAndAlignStorage(std::max<size_t>(dense.capacity() * growthFactor, 1));
                 }
             }
 
             if (!contains(entity)) {
                 const auto pos = dense.size();
+                entitySorted = entitySorted && (dense.empty() || dense.back().getId() < entityId);
+                markPresent(entityId);
                 sparse[entityId] = Entity{static_cast<EntityId>(pos)};
                 dense.push_back(entity);
-                return components.emplace_back(std::forward<Args>(args)...);
+                components.emplace_back(std::forward<Args>(args)...);
+                return components[activate(pos)];
             }
 
             return components[sparse[entityId].getId()];
@@ -118,25 +329,91 @@ namespace vecs {
             if (!contains(entity)) return;
 
             const auto entityId = entity.getId();
+            // An enabled entity first trades places with the last enabled one
+            if (sparse[entityId].getId() < activeCount && --activeCount != dense.size() - 1) {
+                swap(sparse[entityId].getId(), activeCount);
+            }
+
             const auto denseIndex = sparse[entityId].getId();
             const auto lastIndex = dense.size() - 1;
             const auto lastEntity = dense[lastIndex];
+            entitySorted = entitySorted && denseIndex == lastIndex;
 
             components[denseIndex] = std::move(components[lastIndex]);
             dense[denseIndex] = dense[lastIndex];
             sparse[lastEntity.getId()] = Entity{static_cast<EntityId>(denseIndex)};
             sparse[entityId] = Entity::null();
+            markAbsent(entityId);
 
             dense.pop_back();
             components.pop_back();
         }
 
+        /**
+         * @brief Moves the entity at the back into the active partition
+         * @return Dense slot the entity ended up in
+         */
+        size_t activate(const size_t index) noexcept {
+            swap(index, activeCount);
+            return activeCount++;
+        }
+
+        /**
+         * @brief Moves an entity into the disabled tail of the dense array
+         *
+         * Disabled entities keep their components but are left out of probes, so views
+         * skip them. Costs one swap.
+         * @return True if the entity was enabled before
+         */
+        bool disable(const Entity entity) noexcept {
+            if (!contains(entity) || index(entity) >= activeCount) return false;
+
+            swap(index(entity), --activeCount);
+            markAbsent(entity.getId());
+            return true;
+        }
+
+        /**
+         * @return True if the entity was disabled before
+         */
+        bool enable(const Entity entity) {
+            if (!contains(entity) || index(entity) < activeCount) return false;
+
+            activate(index(entity));
+            markPresent(entity.getId());
+            return true;
+        }
+
+        [[nodiscard]] inline bool isActive(const Entity entity) const noexcept {
+            return contains(entity) && index(entity) < activeCount;
+        }
+
+        /**
+         * @brief Swaps two dense slots, keeping the sparse mapping in sync
+         */
+        void swap(const size_t lhs, const size_t rhs) noexcept {
+            if (lhs == rhs) return;
+
+            entitySorted = false;
+            std::swap(components[lhs], components[rhs]);
+            std::swap(dense[lhs], dense[rhs]);
+            sparse[dense[lhs].getId()] = Entity{static_cast<EntityId>(lhs)};
+            sparse[dense[rhs].getId()] = Entity{static_cast<EntityId>(rhs)};
+        }
+
+        [[nodiscard]] inline size_t index(const Entity entity) const noexcept {
+            return sparse[entity.getId()].getId();
+        }
+
         void clear() noexcept {
             const auto sparseSize = sparse.size();
             sparse.clear();
             sparse.resize(sparseSize, Entity::null());
             dense.clear();
             components.clear();
+            std::ranges::fill(presence, PresenceWord{0});
+            activeCount = 0;
+            entitySorted = true;
         }
 
         void reserve(const size_t capacity) {
@@ -144,34 +421,159 @@ namespace vecs {
             sparse.resize(roundUpPow2(capacity), Entity::null());
         }
 
+        /**
+         * @brief Replaces every stored entity through a table indexed by entity ID
+         *
+         * Dense order and components are left untouched; only the sparse mapping is rebuilt.
+         */
+        void remap(const std::span<const Entity> table) noexcept {
+            std::ranges::fill(sparse, Entity::null());
+            std::ranges::fill(presence, PresenceWord{0});
+            for (size_t index = 0; index < dense.size(); ++index) {
+                dense[index] = table[dense[index].getId()];
+                sparse[dense[index].getId()] = Entity{static_cast<EntityId>(index)};
+                if (index < activeCount) markPresent(dense[index].getId());
+            }
+            entitySorted = std::ranges::is_sorted(dense, {}, &Entity::getId);
+        }
+
+        /**
+         * @brief Releases memory kept from past peaks
+         *
+         * Cuts the sparse array and presence bitset just past the highest stored entity
+         * ID and trims every array's capacity to its size. They grow again on demand.
+         */
+        void shrinkToFit() {
+            size_t sparseSize = 0;
+            for (const auto entity : dense) {
+                sparseSize = std::max<size_t>(sparseSize, entity.getId() + 1);
+            }
+
+            sparse.resize(sparseSize);
+            sparse.shrink_to_fit();
+            dense.shrink_to_fit();
+            components.shrink_to_fit();
+            if (presenceTracked) {
+                presence.resize((sparseSize + presenceWordBits - 1) / presenceWordBits);
+                presence.shrink_to_fit();
+            }
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept { return dense.capacity(); }
+        [[nodiscard]] size_t sparseSize() const noexcept { return sparse.size(); }
+
+        [[nodiscard]] MemoryStats memoryStats() const noexcept {
+            return MemoryStats{
+                .sparseBytes = sparse.capacity() * sizeof(Entity) + presence.capacity() * sizeof(PresenceWord),
+                .denseBytes = dense.capacity() * sizeof(Entity),
+                .componentBytes = components.capacity() * sizeof(T),
+                .size = dense.size(),
+                .capacity = dense.capacity(),
+                .sparseSlots = sparse.size(),
+                .emptySparseSlots = sparse.size() - std::min(sparse.size(), dense.size()),
+            };
+        }
+
         template<typename Compare>
         void sort(Compare compare) {
+            sort(std::move(compare), [](std::span<const size_t>) {});
+        }
+
+        /**
+         * @brief Sorts by component and reports the new order, to mirror it in parallel arrays
+         * @param permute Receives, for every new dense slot, the slot it was moved from
+         */
+        template<typename Compare, typename Permute>
+        void sort(Compare compare, Permute permute) {
             if (dense.size() <= 1) return;
 
             std::vector<size_t> indices(dense.size());
             std::iota(indices.begin(), indices.end(), 0);
 
-            std::sort(indices.begin(), indices.end(),
-                [&](size_t a, size_t b) {
-                    return compare(components[a], components[b]);
-                });
+            // Enabled and disabled entities are sorted separately to keep the partition
+            const auto byComponent = [&](size_t a, size_t b) {
+                return compare(components[a], components[b]);
+            };
+            std::sort(indices.begin(), indices.begin() + activeCount, byComponent);
+            std::sort(indices.begin() + activeCount, indices.end(), byComponent);
+            reorder(indices, permute);
+        }
 
-            std::vector<T, Allocator> sortedComponents;
-            std::vector<Entity, EntityAllocator> sortedDense;
-            sortedComponents.reserve(components.size());
-            sortedDense.reserve(dense.size());
+        /**
+         * @brief Restores ascending entity ID order with a radix sort, linear in the size
+         * @param permute Receives, for every new dense slot, the slot it was moved from
+         */
+        template<typename Permute>
+        void sortByEntity(Permute permute) {
+            if (entitySorted || dense.size() <= 1) return;
 
-            for (auto idx : indices) {
-                sortedComponents.push_back(std::move(components[idx]));
-                sortedDense.push_back(dense[idx]);
-                sparse[dense[idx].getId()] = Entity{static_cast<EntityId>(sortedDense.size() - 1)};
+            std::vector<size_t> indices(dense.size());
+            std::iota(indices.begin(), indices.end(), 0);
+            std::vector<size_t> buffer(dense.size());
+            radixSortById(std::span(indices).first(activeCount), buffer);
+            radixSortById(std::span(indices).subspan(activeCount), buffer);
+            reorder(indices, permute);
+        }
+
+        /**
+         * @brief Gets the dense slot of the entity with an ID, or size() if none is stored
+         */
+        [[nodiscard]] inline size_t find(const EntityId id) const noexcept {
+            if (id >= sparse.size()) return dense.size();
+            const auto index = sparse[id].getId();
+            return index < dense.size() && dense[index].getId() == id ? index : dense.size();
+        }
+
+        /**
+         * @brief Rechecks whether dense is in ascending ID order after a series of swaps
+         */
+        bool refreshEntitySorted() noexcept {
+            entitySorted = std::ranges::is_sorted(dense, {}, &Entity::getId);
+            return entitySorted;
+        }
+
+        [[nodiscard]] EntityProbe probe() const noexcept {
+            const auto active = std::span<const Entity>(dense).first(activeCount);
+            if (presenceTracked) {
+                return EntityProbe{sparse, active, entitySorted, presence};
             }
+            return EntityProbe{sparse, active, entitySorted};
+        }
 
-            components = std::move(sortedComponents);
-            dense = std::move(sortedDense);
+        /**
+         * @brief Starts or stops maintaining a presence bitset indexed by entity ID
+         *
+         * Costs one bit per sparse slot and a bit update on every insert and remove.
+         */
+        void trackPresence(const bool enabled) {
+            if (enabled == presenceTracked) return;
+
+            presenceTracked = enabled;
+            presence.clear();
+            if (!enabled) {
+                presence.shrink_to_fit();
+                return;
+            }
+
+            presence.resize((sparse.size() + presenceWordBits - 1) / presenceWordBits, 0);
+            for (const auto entity : std::span<const Entity>(dense).first(activeCount)) {
+                markPresent(entity.getId());
+            }
         }
 
+        [[nodiscard]] constexpr bool tracksPresence() const noexcept { return presenceTracked; }
+
+        /**
+         * @brief Checks whether the dense array is in ascending entity ID order
+         *
+         * Holds while entities are inserted with increasing IDs. Swap-and-pop removal of
+         * anything but the last entity, slot swaps and component sorts clear it.
+         */
+        [[nodiscard]] constexpr bool isEntitySorted() const noexcept { return entitySorted; }
+
         [[nodiscard]] constexpr size_t size() const noexcept { return dense.size(); }
+        // Number of enabled entities, which occupy the front of the dense array
+        [[nodiscard]] constexpr size_t activeSize() const noexcept { return activeCount; }
         [[nodiscard]] constexpr bool empty() const noexcept { return dense.empty(); }
 
         [[nodiscard]] const auto& getEntities() const noexcept { return dense; }
@@ -0,0 +1,191 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef STATEPOOL_H
+#define STATEPOOL_H
+
+#include <array>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include "Pool.h"
+
+namespace vecs {
+    /**
+     * @brief Number of values of a state enum, taken from its Count enumerator by default
+     *
+     * Specialize with a static constexpr size_t value for enums without a Count.
+     */
+    template<typename T>
+    struct StateCount {};
+
+    template<typename T>
+        requires std::is_enum_v<T> && requires { T::Count; }
+    struct StateCount<T> {
+        static constexpr size_t value = static_cast<size_t>(T::Count);
+    };
+
+    template<typename T>
+    concept StateComponent = std::is_enum_v<T> && requires {
+        { StateCount<T>::value } -> std::convertible_to<size_t>;
+    };
+
+    /**
+     * @brief Storage for enum-like state components, partitioned by value
+     *
+     * The dense array holds every entity in state 0 first, then every entity in state 1,
+     * and so on, so the entities of one state form a contiguous slice that can be walked
+     * without testing the state of each entity. A transition moves the entity across
+     * each partition boundary between its old and new state with a single swap, so
+     * moving between neighbouring states costs one swap.
+     */
+    template<StateComponent T>
+    class StatePool final : public BasePool {
+        static constexpr size_t stateCount = StateCount<T>::value;
+        static_assert(stateCount > 0, "A state component needs at least one state");
+
+        SparseSet<T> states;
+        // First dense index of every state; a state ends where the next one begins
+        std::array<size_t, stateCount> offsets{};
+
+        [[nodiscard]] static size_t slot(const T state) noexcept { return static_cast<size_t>(state); }
+
+        [[nodiscard]] static size_t checkedSlot(const T state) {
+            const auto index = static_cast<size_t>(state);
+            if (index >= stateCount) {
+                throw std::runtime_error("State value out of range");
+            }
+            return index;
+        }
+
+        [[nodiscard]] size_t end(const size_t state) const noexcept {
+            return state + 1 < stateCount ? offsets[state + 1] : states.size();
+        }
+
+        // Moves the entity at index from its state to target, returning its new index
+        size_t move(size_t index, const size_t from, const size_t target) noexcept {
+            for (size_t state = from; state < target; ++state) {
+                const auto last = --offsets[state + 1];
+                states.swap(index, last);
+                index = last;
+            }
+            for (size_t state = from; state > target; --state) {
+                const auto first = offsets[state]++;
+                states.swap(index, first);
+                index = first;
+            }
+            return index;
+        }
+
+    public:
+        StatePool() = default;
+        explicit StatePool(const size_t initialCapacity) : states(initialCapacity) {}
+
+        /**
+         * @brief Sets the state of an entity, adding it to the pool if needed
+         * @throws std::runtime_error if state is not below StateCount<T>::value
+         */
+        void insert(const Entity entity, const T state) {
+            const auto target = checkedSlot(state);
+            if (states.contains(entity)) {
+                transition(entity, state);
+                return;
+            }
+
+            // A new entity enters the last partition and walks down to its state
+            states.insert(entity, T{state});
+            move(states.size() - 1, stateCount - 1, target);
+            notifyInsert(entity);
+        }
+
+        /**
+         * @throws std::runtime_error if state is not below StateCount<T>::value
+         */
+        void transition(const Entity entity, const T state) {
+            const auto target = checkedSlot(state);
+            const auto index = states.index(entity);
+            const auto from = slot(states.get(entity));
+            if (from == target) return;
+
+            states.get(entity) = state;
+            move(index, from, target);
+        }
+
+        [[nodiscard]] inline T get(const Entity entity) const noexcept {
+            return states.get(entity);
+        }
+
+        [[nodiscard]] inline bool has(const Entity entity) const noexcept {
+            return states.contains(entity);
+        }
+
+        /**
+         * @brief Gets the contiguous slice of entities currently in a state
+         *
+         * Invalidated by any insert, transition or removal. Empty for a state not below
+         * StateCount<T>::value, since no entity can be in it.
+         */
+        [[nodiscard]] std::span<const Entity> entities(const T state) const noexcept {
+            const auto index = slot(state);
+            if (index >= stateCount) return {};
+
+            const auto first = offsets[index];
+            return std::span<const Entity>(states.getEntities()).subspan(first, end(index) - first);
+        }
+
+        /**
+         * @brief Gets the number of entities in a state, 0 for a state out of range
+         */
+        [[nodiscard]] size_t size(const T state) const noexcept {
+            const auto index = slot(state);
+            return index < stateCount ? end(index) - offsets[index] : 0;
+        }
+
+        void removeEntity(const Entity entity) override {
+            if (!states.contains(entity)) return;
+
+            notifyRemove(entity);
+            // Moving the entity to the back lets swap-and-pop remove it without breaking a partition
+            move(states.index(entity), slot(states.get(entity)), stateCount - 1);
+            states.swap(states.index(entity), states.size() - 1);
+            states.remove(entity);
+        }
+
+        [[nodiscard]] size_t size() const override {
+            return states.size();
+        }
+
+        void clear() override {
+            states.clear();
+            offsets.fill(0);
+            notifyClear();
+        }
+
+        void reserve(const size_t capacity) override {
+            states.reserve(capacity);
+        }
+
+        void remapEntities(const std::span<const Entity> table) override {
+            states.remap(table);
+        }
+
+        void shrinkToFit() override {
+            states.shrinkToFit();
+        }
+
+        [[nodiscard]] EntityProbe probe() const noexcept override {
+            return states.probe();
+        }
+
+        [[nodiscard]] MemoryStats memoryStats() const noexcept override {
+            auto stats = states.memoryStats();
+            stats.metadataBytes += sizeof(offsets);
+            return stats;
+        }
+
+        [[nodiscard]] const auto& getEntities() const noexcept { return states.getEntities(); }
+    };
+}
+
+#endif
@@ -0,0 +1,91 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+#ifndef STORAGECHUNK_H
+#define STORAGECHUNK_H
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <variant>
+
+#include "Entity.h"
+
+namespace vecs {
+    using Tick = std::uint64_t;
+
+    /**
+     * @brief Target size of a storage chunk, chosen to stay well inside L1/L2
+     */
+    inline constexpr size_t storageChunkBytes = 16 * 1024;
+
+    /**
+     * @brief Number of components of type T stored in one chunk of a pool
+     */
+    template<typename T>
+    inline constexpr size_t storageChunkCapacity = sizeof(T) >= storageChunkBytes ? 1 : storageChunkBytes / sizeof(T);
+
+    /**
+     * @brief Specialize to give chunks of T a bounding summary, e.g. an AABB for positions
+     *
+     * A specialization provides a Type and a static Type compute(std::span<const T>).
+     * Pools cache the bounds of a chunk when a mutable chunk iteration visits it and drop
+     * them when the chunk changes. Const readers compute stale bounds on the fly without
+     * writing the cache, so they stay safe to run concurrently.
+     */
+    template<typename T>
+    struct ChunkBounds {};
+
+    template<typename T>
+    concept BoundedComponent = requires(std::span<const T> values) {
+        typename ChunkBounds<T>::Type;
+        { ChunkBounds<T>::compute(values) } -> std::convertible_to<typename ChunkBounds<T>::Type>;
+    };
+
+    template<typename T>
+    struct ChunkBoundsTypeOf {
+        using Type = std::monostate;
+    };
+
+    template<BoundedComponent T>
+    struct ChunkBoundsTypeOf<T> {
+        using Type = typename ChunkBounds<T>::Type;
+    };
+
+    template<typename T>
+    using ChunkBoundsType = typename ChunkBoundsTypeOf<std::remove_const_t<T>>::Type;
+
+    /**
+     * @brief Specialize deriving from std::true_type to keep per-chunk change ticks for T
+     *
+     * Chunk bookkeeping runs on every insert, removal and reorder, so only pools of
+     * tracked types pay for it and only they can be walked with eachStorageChunk.
+     * Components with ChunkBounds are tracked without a specialization.
+     */
+    template<typename T>
+    struct TrackChunks : std::bool_constant<BoundedComponent<T>> {};
+
+    template<typename T>
+    concept ChunkTrackedComponent = TrackChunks<std::remove_const_t<T>>::value;
+
+    /**
+     * @brief A fixed-size slice of a pool's dense arrays with its metadata
+     *
+     * Entities and components are the pool's own storage, so a chunk stays valid only
+     * until components of that type are added or removed.
+     */
+    template<typename T>
+    struct StorageChunk {
+        std::span<const Entity> entities;
+        std::span<T> components;
+        // Tick of the last insert, removal, reorder or mutable access touching the chunk
+        Tick changeTick = 0;
+        // std::monostate unless ChunkBounds<T> is specialized
+        ChunkBoundsType<T> bounds{};
+
+        [[nodiscard]] size_t size() const noexcept { return entities.size(); }
+    };
+}
+
+#endif
@@ -4,67 +4,710 @@
 #ifndef VIEW_H
 #define VIEW_H
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <functional>
+#include <iterator>
 #include <tuple>
+#include <span>
+#include <vector>
 #include "Pool.h"
+#include "Fused.h"
+#include "FlagPool.h"
+#include "SharedPool.h"
 
 namespace vecs {
+    /**
+     * @brief Marks a view component as optional
+     *
+     * Optional components do not filter the view; the callback receives a pointer that
+     * is null when the entity does not have the component.
+     */
+    template<typename T>
+    struct Optional {};
+
+    /**
+     * @brief Filters a view by a flag stored in a FlagPool
+     *
+     * The callback receives a const reference to a default-constructed T.
+     */
+    template<typename T>
+    struct Flag {};
+
+    template<typename T>
+    inline constexpr bool isFlag = false;
+
+    template<typename T>
+    inline constexpr bool isFlag<Flag<T>> = true;
+
+    /**
+     * @brief Reads a component stored once per distinct value in a SharedPool
+     *
+     * The callback receives a const reference to the shared instance.
+     */
+    template<typename T>
+    struct Shared {};
+
+    template<typename T>
+    inline constexpr bool isShared = false;
+
+    template<typename T>
+    inline constexpr bool isShared<Shared<T>> = true;
+
+    /**
+     * @brief Describes how a view stores, filters and passes one of its components
+     */
+    template<typename T>
+    struct ViewComponent {
+        using Component = std::remove_const_t<T>;
+        using Storage = PoolFor<T>*;
+        using Argument = T&;
+        using ChunkElement = T;
+        using Buffered = std::remove_const_t<T>;
+
+        // Entities must be in the pool
+        static constexpr bool required = true;
+        // The pool has dense entity and component arrays that can be walked and written back
+        static constexpr bool dense = true;
+        static constexpr bool readOnly = std::is_const_v<T>;
+
+        [[nodiscard]] static const PoolFor<T>* pool(const Storage storage) noexcept { return storage; }
+
+        [[nodiscard]] static Argument fetch(const Storage storage, const Entity entity) noexcept {
+            return storage->get(entity);
+        }
+    };
+
+    /**
+     * @brief Component stored inside a fused pool, fetched from its slot in the Fused value
+     */
+    template<typename T>
+        requires FusedComponent<std::remove_const_t<T>>
+    struct ViewComponent<T> {
+        using Component = std::remove_const_t<T>;
+        using Fusion = FusedStorageType<Component>;
+        using Storage = PoolFor<std::conditional_t<std::is_const_v<T>, const Fusion, Fusion>>*;
+        using Argument = T&;
+        using ChunkElement = T;
+        using Buffered = Component;
+
+        static constexpr bool required = true;
+        static constexpr bool dense = false;
+        static constexpr bool readOnly = std::is_const_v<T>;
+
+        [[nodiscard]] static const Pool<Fusion>* pool(const Storage storage) noexcept { return storage; }
+
+        [[nodiscard]] static Argument fetch(const Storage storage, const Entity entity) noexcept {
+            return storage->get(entity).template get<Component>();
+        }
+    };
+
+    template<typename T>
+    struct ViewComponent<Optional<T>> {
+        using Component = std::remove_const_t<T>;
+        struct Storage {
+            PoolFor<T>* pool = nullptr;
+        };
+        using Argument = T*;
+        using ChunkElement = T*;
+        using Buffered = T*;
+
+        static constexpr bool required = false;
+        static constexpr bool dense = false;
+        static constexpr bool readOnly = std::is_const_v<T>;
+
+        [[nodiscard]] static const PoolFor<T>* pool(const Storage storage) noexcept { return storage.pool; }
+
+        [[nodiscard]] static Argument fetch(const Storage storage, const Entity entity) noexcept {
+            return storage.pool && storage.pool->has(entity) ? &storage.pool->get(entity) : nullptr;
+        }
+    };
+
+    template<typename T>
+    struct ViewComponent<Flag<T>> {
+        using Component = std::remove_const_t<T>;
+        using Storage = const FlagPool<Component>*;
+        using Argument = const Component&;
+        using ChunkElement = const Component;
+        using Buffered = Component;
+
+        static constexpr bool required = true;
+        static constexpr bool dense = false;
+        static constexpr bool readOnly = true;
+
+        [[nodiscard]] static const FlagPool<Component>* pool(const Storage storage) noexcept { return storage; }
+
+        [[nodiscard]] static Argument fetch(const Storage, const Entity) noexcept {
+            static const Component tag{};
+            return tag;
+        }
+    };
+
+    template<typename T>
+    struct ViewComponent<Shared<T>> {
+        using Component = std::remove_const_t<T>;
+        using Storage = const SharedPool<Component>*;
+        using Argument = const Component&;
+        using ChunkElement = const Component;
+        using Buffered = Component;
+
+        static constexpr bool required = true;
+        static constexpr bool dense = false;
+        static constexpr bool readOnly = true;
+
+        [[nodiscard]] static const SharedPool<Component>* pool(const Storage storage) noexcept { return storage; }
+
+        [[nodiscard]] static Argument fetch(const Storage storage, const Entity entity) noexcept {
+            return storage->get(entity);
+        }
+    };
+
     template<typename... Components>
     class View {
-        using ComponentPools = std::tuple<Pool<Components>*...>;
+        static_assert(((ViewComponent<Components>::required && !isFlag<Components>) || ...),
+            "A view needs at least one required component that is not a flag");
+
+        using ComponentPools = std::tuple<typename ViewComponent<Components>::Storage...>;
         ComponentPools pools;
 
-        [[nodiscard]] BasePool* findSmallestPool() const noexcept {
-            BasePool* smallest = nullptr;
-            size_t minSize = std::numeric_limits<size_t>::max();
+        // Fused components share a pool, so storages are looked up by position rather than type
+        template<typename T>
+        static constexpr size_t storageIndex = [] {
+            constexpr std::array matches{std::is_same_v<T, Components>...};
+            return static_cast<size_t>(std::ranges::find(matches, true) - matches.begin());
+        }();
+
+        template<typename T>
+        [[nodiscard]] static auto storage(const ComponentPools& pools) noexcept {
+            return std::get<storageIndex<T>>(pools);
+        }
+
+        static constexpr size_t requiredCount = (size_t{ViewComponent<Components>::required} + ...);
+
+        // Membership probes of every required pool except the one being walked
+        using Probes = std::array<EntityProbe, requiredCount - 1>;
+
+        /**
+         * The entities of the smallest required pool, plus probes for the remaining
+         * required pools sorted by ascending size, so the pool most likely to reject a
+         * candidate is checked first. Resolved once per iteration, since pool sizes
+         * change between frames. Pools shared by several components, such as fused
+         * storages, are probed once. When every required pool tracks presence and the
+         * bitsets are shorter than the candidate list, the bitsets are intersected
+         * instead; when every required pool is entity-sorted, the pools are merge joined.
+         */
+        struct Candidates {
+            std::span<const Entity> entities;
+            Probes probes{};
+            size_t probeCount = 0;
+            EntityProbe driver{};
+            bool mergeJoin = false;
+            bool presenceScan = false;
+
+            [[nodiscard]] std::span<const EntityProbe> probed() const noexcept { return {probes.data(), probeCount}; }
+        };
+
+        static constexpr size_t presenceLanes = 4;
 
-            auto checkPool = [&minSize, &smallest](BasePool* pool) {
-                if (const auto size = pool->size(); size < minSize) {
-                    minSize = size;
-                    smallest = pool;
+    public:
+        static constexpr size_t defaultChunkSize = 16;
+        static constexpr size_t autoPrefetch = std::numeric_limits<size_t>::max();
+        static constexpr size_t defaultPrefetchDistance = 16;
+        static constexpr size_t prefetchThresholdBytes = 1 << 20;
+
+    private:
+        size_t prefetchDistance = autoPrefetch;
+
+        [[nodiscard]] Candidates findCandidates() const noexcept {
+            if (!hasAllPools()) return {};
+
+            std::array<EntityProbe, requiredCount> probes;
+            size_t next = 0;
+            auto collect = [&probes, &next]<typename T>(const ComponentPools& componentPools) {
+                if constexpr (ViewComponent<T>::required) {
+                    probes[next++] = ViewComponent<T>::pool(storage<T>(componentPools))->probe();
                 }
             };
+            (collect.template operator()<Components>(pools), ...);
+
+            // Membership-only probes have no entities to walk, so they never drive the view
+            std::ranges::sort(probes, std::less{}, [](const EntityProbe& probe) {
+                return probe.hasEntities() ? probe.size() : std::numeric_limits<size_t>::max();
+            });
+
+            size_t distinct = 0;
+            for (const auto& probe : probes) {
+                const auto kept = std::span(probes).first(distinct);
+                if (std::ranges::none_of(kept, [&probe](const EntityProbe& other) { return other.sameSource(probe); })) {
+                    probes[distinct++] = probe;
+                }
+            }
+
+            Candidates candidates{probes[0].getEntities()};
+            if constexpr (requiredCount > 1) {
+                std::copy(probes.begin() + 1, probes.begin() + distinct, candidates.probes.begin());
+                candidates.probeCount = distinct - 1;
+            }
+            candidates.driver = probes[0];
+            candidates.mergeJoin = distinct > 1 &&
+                std::ranges::all_of(std::span(probes).first(distinct), &EntityProbe::isEntitySorted);
+            candidates.presenceScan = distinct > 1 && allTrackPresence(candidates) &&
+                                      presenceWords(candidates) <= candidates.entities.size();
+            return candidates;
+        }
+
+        // Views created from a const ECS hold null pointers for pools that do not exist yet
+        [[nodiscard]] bool hasAllPools() const noexcept {
+            return ((!ViewComponent<Components>::required ||
+                     ViewComponent<Components>::pool(storage<Components>(pools)) != nullptr) && ...);
+        }
+
+        [[nodiscard]] static bool matches(const std::span<const EntityProbe> probes, const Entity entity) noexcept {
+            for (const auto& probe : probes) {
+                if (!probe.contains(entity)) return false;
+            }
+            return true;
+        }
+
+        [[nodiscard]] static bool allTrackPresence(const Candidates& candidates) noexcept {
+            return candidates.driver.tracksPresence() &&
+                   std::ranges::all_of(candidates.probed(), &EntityProbe::tracksPresence);
+        }
+
+        [[nodiscard]] static size_t presenceWords(const Candidates& candidates) noexcept {
+            size_t words = candidates.driver.getPresence().size();
+            for (const auto& probe : candidates.probed()) {
+                words = std::min(words, probe.getPresence().size());
+            }
+            return words;
+        }
+
+        /**
+         * ANDs the presence bitsets of every required pool presenceLanes words (256 bits)
+         * at a time, a fixed-width loop the compiler turns into vector instructions, and
+         * hands each resulting word to the visitor with its index.
+         */
+        template<typename Visitor>
+        static void intersectPresence(const Candidates& candidates, Visitor&& visit) {
+            const size_t words = presenceWords(candidates);
+            const auto* driver = candidates.driver.getPresence().data();
+
+            size_t base = 0;
+            for (; base + presenceLanes <= words; base += presenceLanes) {
+                std::array<PresenceWord, presenceLanes> block;
+                for (size_t lane = 0; lane < presenceLanes; ++lane) {
+                    block[lane] = driver[base + lane];
+                }
+                for (const auto& probe : candidates.probed()) {
+                    const auto* bits = probe.getPresence().data();
+                    for (size_t lane = 0; lane < presenceLanes; ++lane) {
+                        block[lane] &= bits[base + lane];
+                    }
+                }
+                for (size_t lane = 0; lane < presenceLanes; ++lane) {
+                    visit(base + lane, block[lane]);
+                }
+            }
+
+            for (; base < words; ++base) {
+                PresenceWord word = driver[base];
+                for (const auto& probe : candidates.probed()) {
+                    word &= probe.getPresence()[base];
+                }
+                visit(base, word);
+            }
+        }
+
+        template<typename Callback>
+        static void scanPresence(const Candidates& candidates, Callback&& callback) {
+            intersectPresence(candidates, [&candidates, &callback](const size_t index, PresenceWord bits) {
+                while (bits != 0) {
+                    const auto id = static_cast<EntityId>(index * presenceWordBits + std::countr_zero(bits));
+                    bits &= bits - 1;
+                    callback(candidates.driver.find(id));
+                }
+            });
+        }
+
+        /**
+         * Walks the candidates and every probed dense array in ascending ID order, moving
+         * one cursor per pool forward with a galloping search. Matching entities are then
+         * fetched through sparse and component slots that are also in ascending order, so
+         * the whole join reads memory sequentially.
+         */
+        template<typename Callback>
+        static void mergeJoin(const Candidates& candidates, Callback&& callback) {
+            std::array<size_t, requiredCount - 1> cursors{};
+
+            for (const auto entity : candidates.entities) {
+                bool matched = true;
+                for (size_t i = 0; i < candidates.probeCount; ++i) {
+                    const auto& probe = candidates.probes[i];
+                    cursors[i] = probe.seek(cursors[i], entity.getId());
+                    if (cursors[i] == probe.size() || probe.at(cursors[i]) != entity) {
+                        matched = false;
+                        break;
+                    }
+                }
+
+                if (matched) callback(entity);
+            }
+        }
+
+        template<typename Callback>
+        static void forEachMatch(const Candidates& candidates, Callback&& callback) {
+            if (candidates.presenceScan) {
+                scanPresence(candidates, callback);
+            } else if (candidates.mergeJoin) {
+                mergeJoin(candidates, callback);
+            } else {
+                for (const auto entity : candidates.entities) {
+                    if (matches(candidates.probed(), entity)) callback(entity);
+                }
+            }
+        }
+
+        // Components handed out by reference are copied back; optional ones are already pointers
+        template<typename T>
+        void writeBack(const Entity entity, typename ViewComponent<T>::Buffered& value) const {
+            if constexpr (std::is_lvalue_reference_v<typename ViewComponent<T>::Argument> && !ViewComponent<T>::readOnly) {
+                ViewComponent<T>::fetch(storage<T>(pools), entity) = std::move(value);
+            }
+        }
+
+        template<typename T, typename Buffers>
+        [[nodiscard]] static auto& buffer(Buffers& buffers) noexcept {
+            return std::get<std::vector<typename ViewComponent<T>::Buffered>>(buffers);
+        }
+
+        template<typename T>
+        static void prefetchSparse(const ComponentPools& pools, const Entity entity) noexcept {
+            if constexpr (ViewComponent<T>::dense) {
+                storage<T>(pools)->prefetchSparse(entity);
+            }
+        }
 
-            (checkPool(std::get<Pool<Components>*>(pools)), ...);
-            return smallest;
+        template<typename T>
+        static void prefetchComponent(const ComponentPools& pools, const Entity entity) noexcept {
+            if constexpr (ViewComponent<T>::dense) {
+                storage<T>(pools)->prefetchComponent(entity);
+            }
         }
 
-        template<typename Entity>
-        [[nodiscard]] constexpr bool entityExistsInAllPools(Entity entity) const noexcept {
-            return (std::get<Pool<Components>*>(pools)->has(entity) && ...);
+        template<typename T>
+        [[nodiscard]] size_t footprint() const noexcept {
+            if constexpr (ViewComponent<T>::dense) {
+                return storage<T>(pools)->size() * (sizeof(typename ViewComponent<T>::Component) + 2 * sizeof(Entity));
+            } else {
+                return 0;
+            }
+        }
+
+        template<typename Func>
+        static void invoke(const ComponentPools& pools, const Entity entity, Func& function) {
+            if constexpr (std::is_invocable_v<Func, Entity, typename ViewComponent<Components>::Argument...>) {
+                function(entity, ViewComponent<Components>::fetch(storage<Components>(pools), entity)...);
+            } else if constexpr (std::is_invocable_v<Func, typename ViewComponent<Components>::Argument...>) {
+                function(ViewComponent<Components>::fetch(storage<Components>(pools), entity)...);
+            } else if constexpr (std::is_invocable_v<Func, Entity>) {
+                function(entity);
+            }
+        }
+
+        /**
+         * Without prefetching this is a plain probe loop. With a distance of N, the sparse
+         * slots of the entity N candidates ahead are requested first, and the dense and
+         * component slots of the entity N/2 ahead once its sparse slot has had time to
+         * arrive, so the two dependent misses of each probe overlap with useful work.
+         */
+        template<typename Func>
+        static void eachIn(const ComponentPools& pools, const Candidates& candidates,
+                           const size_t prefetchDistance, Func& function) {
+            const auto entities = candidates.entities;
+            if (candidates.presenceScan || candidates.mergeJoin || prefetchDistance == 0) {
+                forEachMatch(candidates, [&pools, &function](const Entity entity) {
+                    invoke(pools, entity, function);
+                });
+                return;
+            }
+
+            const size_t count = entities.size();
+            const size_t componentDistance = std::max<size_t>(prefetchDistance / 2, 1);
+            for (size_t i = 0; i < count; ++i) {
+                if (i + prefetchDistance < count) {
+                    (prefetchSparse<Components>(pools, entities[i + prefetchDistance]), ...);
+                }
+                if (i + componentDistance < count) {
+                    (prefetchComponent<Components>(pools, entities[i + componentDistance]), ...);
+                }
+
+                if (matches(candidates.probed(), entities[i])) {
+                    invoke(pools, entities[i], function);
+                }
+            }
+        }
+
+        /**
+         * Prefetching only helps once the probed pools no longer fit in cache, so below
+         * prefetchThresholdBytes of touched storage the plain loop is used.
+         */
+        [[nodiscard]] size_t resolvePrefetchDistance() const noexcept {
+            if (prefetchDistance != autoPrefetch) return prefetchDistance;
+
+            if constexpr (sizeof...(Components) == 1) {
+                return 0;
+            } else if (!hasAllPools()) {
+                return 0;
+            } else {
+                const size_t bytes = (footprint<Components>() + ...);
+                return bytes > prefetchThresholdBytes ? defaultPrefetchDistance : 0;
+            }
         }
 
     public:
         explicit View(ComponentPools componentPools) noexcept
             : pools(componentPools) {}
 
+        /**
+         * @brief Returns a copy of the view using a fixed prefetch distance
+         * @param distance Number of candidates to prefetch ahead, 0 disables prefetching
+         * and autoPrefetch picks a distance from the size of the pools
+         */
+        [[nodiscard]] View withPrefetchDistance(const size_t distance) const noexcept {
+            View copy = *this;
+            copy.prefetchDistance = distance;
+            return copy;
+        }
+
+        [[nodiscard]] size_t getPrefetchDistance() const noexcept {
+            return resolvePrefetchDistance();
+        }
+
+        /**
+         * @brief Forward iterator over the entities matching all components
+         *
+         * Walks the smallest pool's dense entity array and skips entities missing from
+         * any other pool, which is the same loop each() runs.
+         */
+        class Iterator {
+            Probes probes{};
+            size_t probeCount = 0;
+            const Entity* current = nullptr;
+            const Entity* last = nullptr;
+
+            void skipUnmatched() noexcept {
+                while (current != last && !matches(std::span(probes).first(probeCount), *current)) {
+                    ++current;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = Entity;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Entity*;
+            using reference = const Entity&;
+
+            Iterator() noexcept = default;
+
+            Iterator(const Candidates& candidates, const Entity* first, const Entity* end) noexcept
+                : probes(candidates.probes), probeCount(candidates.probeCount), current(first), last(end) {
+                skipUnmatched();
+            }
+
+            [[nodiscard]] reference operator*() const noexcept { return *current; }
+            [[nodiscard]] pointer operator->() const noexcept { return current; }
+
+            Iterator& operator++() noexcept {
+                ++current;
+                skipUnmatched();
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] bool operator==(const Iterator& other) const noexcept {
+                return current == other.current;
+            }
+        };
+
+        /**
+         * @brief A slice of the smallest pool's entities, safe to process independently
+         *
+         * Chunks hold their own copy of the pool pointers, so they stay usable after the
+         * view that produced them goes out of scope.
+         */
+        class Chunk {
+            ComponentPools pools;
+            Candidates candidates;
+            size_t prefetchDistance;
+
+        public:
+            Chunk(ComponentPools componentPools, Candidates chunkCandidates, const size_t distance = 0) noexcept
+                : pools(componentPools), candidates(chunkCandidates), prefetchDistance(distance) {}
+
+            [[nodiscard]] Iterator begin() const noexcept {
+                const auto entities = candidates.entities;
+                return Iterator{candidates, entities.data(), entities.data() + entities.size()};
+            }
+
+            [[nodiscard]] Iterator end() const noexcept {
+                const auto* last = candidates.entities.data() + candidates.entities.size();
+                return Iterator{candidates, last, last};
+            }
+
+            template<typename Func>
+            void each(Func&& function) const {
+                eachIn(pools, candidates, prefetchDistance, function);
+            }
+        };
+
         template<typename Func>
         void each(Func&& function) const {
-            const auto* smallest = static_cast<Pool<std::tuple_element_t<0, std::tuple<Components...>>>*>(findSmallestPool());
-            if (!smallest) return;
+            eachIn(pools, findCandidates(), resolvePrefetchDistance(), function);
+        }
 
-            const auto& entities = smallest->getEntities();
+        [[nodiscard]] Iterator begin() const noexcept {
+            const auto candidates = findCandidates();
+            const auto entities = candidates.entities;
+            return Iterator{candidates, entities.data(), entities.data() + entities.size()};
+        }
 
-            if constexpr (std::is_invocable_v<Func, Entity, Components&...>) {
-                for (const auto entity : entities) {
-                    if (entityExistsInAllPools(entity)) {
-                        function(entity, std::get<Pool<Components>*>(pools)->get(entity)...);
-                    }
-                }
-            } else if constexpr (std::is_invocable_v<Func, Components&...>) {
-                for (const auto entity : entities) {
-                    if (entityExistsInAllPools(entity)) {
-                        function(std::get<Pool<Components>*>(pools)->get(entity)...);
-                    }
+        [[nodiscard]] Iterator end() const noexcept {
+            const auto candidates = findCandidates();
+            const auto* last = candidates.entities.data() + candidates.entities.size();
+            return Iterator{candidates, last, last};
+        }
+
+        /**
+         * @brief Counts the entities matching all required components
+         *
+         * A popcount over the intersected presence bitsets when every required pool tracks
+         * presence, otherwise a walk over the candidates.
+         */
+        [[nodiscard]] size_t count() const noexcept {
+            const auto candidates = findCandidates();
+            if constexpr (requiredCount == 1) {
+                return candidates.entities.size();
+            } else {
+                if (candidates.probeCount == 0) return candidates.entities.size();
+
+                size_t total = 0;
+                if (allTrackPresence(candidates)) {
+                    intersectPresence(candidates, [&total](size_t, const PresenceWord bits) {
+                        total += static_cast<size_t>(std::popcount(bits));
+                    });
+                } else {
+                    forEachMatch(candidates, [&total](Entity) { ++total; });
                 }
-            } else if constexpr (std::is_invocable_v<Func, Entity>) {
-                for (const auto entity : entities) {
-                    if (entityExistsInAllPools(entity)) {
-                        function(entity);
+                return total;
+            }
+        }
+
+        /**
+         * @brief Gets a component of an entity without checking that it is present
+         */
+        template<typename T>
+        [[nodiscard]] decltype(auto) get(const Entity entity) const noexcept {
+            return ViewComponent<T>::fetch(storage<T>(pools), entity);
+        }
+
+        /**
+         * @brief Splits the candidate entities into chunks for parallel algorithms
+         * @param chunkSize Number of candidate entities per chunk
+         * @return Random-access range of chunks, each iterable on its own
+         */
+        [[nodiscard]] std::vector<Chunk> chunks(const size_t chunkSize = 4096) const {
+            const auto candidates = findCandidates();
+            const auto entities = candidates.entities;
+            const auto distance = resolvePrefetchDistance();
+            std::vector<Chunk> result;
+            if (chunkSize == 0) return result;
+
+            result.reserve((entities.size() + chunkSize - 1) / chunkSize);
+            for (size_t offset = 0; offset < entities.size(); offset += chunkSize) {
+                auto chunk = candidates;
+                chunk.entities = entities.subspan(offset, std::min(chunkSize, entities.size() - offset));
+                chunk.presenceScan = false;
+                result.emplace_back(pools, chunk, distance);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Walks a single-component view one storage chunk at a time
+         * @param since Chunks not changed after this tick are skipped, 0 visits all
+         *
+         * The callback receives a StorageChunk with the chunk's entities, components,
+         * change tick and bounds. Mutable views stamp each visited chunk as changed.
+         * Only available for chunk-tracked components, see TrackChunks.
+         */
+        template<typename Func>
+            requires (sizeof...(Components) == 1 && (ViewComponent<Components>::dense && ...) &&
+                      (ChunkTrackedComponent<typename ViewComponent<Components>::Component> && ...))
+        void eachStorageChunk(Func&& function, const Tick since = 0) const {
+            if (auto* pool = std::get<0>(pools)) {
+                pool->eachChunk(function, since);
+            }
+        }
+
+        /**
+         * @brief Iterates matching entities in contiguous batches
+         *
+         * The callback receives a span of entities followed by one span per component type,
+         * all of the same length. Single-component views hand over the whole dense arrays in
+         * one call. Joined views gather up to ChunkSize matches into scratch buffers, invoke
+         * the callback, then write the components back to their pools. Optional components
+         * are passed as spans of pointers, null where the component is missing.
+         * Components must not be added or removed while iterating.
+         */
+        template<size_t ChunkSize = defaultChunkSize, typename Func>
+        void eachChunk(Func&& function) const {
+            static_assert(ChunkSize > 0, "Chunk size must be positive");
+
+            if constexpr (sizeof...(Components) == 1 && (ViewComponent<Components>::dense && ...)) {
+                auto* pool = std::get<0>(pools);
+                if (!pool || pool->activeSize() == 0) return;
+
+                function(std::span<const Entity>(pool->getEntities()).first(pool->activeSize()),
+                         std::span<Components>(pool->getComponents()).first(pool->activeSize())...);
+            } else {
+                std::array<Entity, ChunkSize> entities;
+                std::tuple<std::vector<typename ViewComponent<Components>::Buffered>...> buffers;
+                (buffer<Components>(buffers).reserve(ChunkSize), ...);
+                size_t count = 0;
+
+                auto flush = [&] {
+                    function(std::span<const Entity>(entities.data(), count),
+                             std::span<typename ViewComponent<Components>::ChunkElement>(buffer<Components>(buffers))...);
+
+                    for (size_t i = 0; i < count; ++i) {
+                        (writeBack<Components>(entities[i], buffer<Components>(buffers)[i]), ...);
                     }
-                }
+                    (buffer<Components>(buffers).clear(), ...);
+                    count = 0;
+                };
+
+                auto gather = [&](const Entity entity) {
+                    entities[count++] = entity;
+                    (buffer<Components>(buffers).push_back(
+                        ViewComponent<Components>::fetch(storage<Components>(pools), entity)), ...);
+
+                    if (count == ChunkSize) flush();
+                };
+
+                forEachMatch(findCandidates(), gather);
+
+                if (count > 0) flush();
             }
         }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
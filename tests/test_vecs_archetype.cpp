@@ -0,0 +1,195 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include "../src/vecs/Archetype.h"
+
+struct Position {
+    float x, y;
+    bool operator==(const Position& other) const {
+        return x == other.x && y == other.y;
+    }
+};
+
+struct Velocity {
+    float dx, dy;
+    bool operator==(const Velocity& other) const {
+        return dx == other.dx && dy == other.dy;
+    }
+};
+
+struct Health {
+    int value;
+    bool operator==(const Health& other) const {
+        return value == other.value;
+    }
+};
+
+class ArchetypeTest : public testing::Test {
+protected:
+    vecs::ArchetypeECS ecs;
+
+    void SetUp() override {
+        ecs.clear();
+    }
+};
+
+TEST_F(ArchetypeTest, ComponentsMoveBetweenTables) {
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Position{1.0f, 2.0f});
+    ecs.addComponent(entity, Velocity{3.0f, 4.0f});
+    ecs.emplaceComponent<Health>(entity, 100);
+
+    EXPECT_EQ(ecs.archetypeCount(), 3u);
+    EXPECT_TRUE((ecs.hasComponents<Position, Velocity, Health>(entity)));
+    EXPECT_EQ(ecs.getComponent<Position>(entity), (Position{1.0f, 2.0f}));
+    EXPECT_EQ(ecs.getComponent<Velocity>(entity), (Velocity{3.0f, 4.0f}));
+    EXPECT_EQ(ecs.getComponent<Health>(entity).value, 100);
+
+    ecs.removeComponent<Velocity>(entity);
+    EXPECT_FALSE(ecs.hasComponent<Velocity>(entity));
+    EXPECT_EQ(ecs.getComponent<Position>(entity), (Position{1.0f, 2.0f}));
+    EXPECT_EQ(ecs.getComponent<Health>(entity).value, 100);
+    EXPECT_THROW(static_cast<void>(ecs.getComponent<Velocity>(entity)), std::runtime_error);
+
+    ecs.replaceComponent(entity, Health{50});
+    EXPECT_EQ(ecs.getComponent<Health>(entity).value, 50);
+
+    ecs.removeComponents<Position, Health>(entity);
+    EXPECT_FALSE(ecs.hasComponent<Position>(entity));
+    EXPECT_TRUE(ecs.isValid(entity));
+}
+
+TEST_F(ArchetypeTest, SwapRemoveKeepsOtherRowsIntact) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Health{i});
+        entities.push_back(entity);
+    }
+
+    ecs.destroyEntity(entities[0]);
+    ecs.addComponent(entities[3], Position{3.0f, 0.0f});
+
+    EXPECT_FALSE(ecs.isValid(entities[0]));
+    for (int i = 1; i < 10; ++i) {
+        EXPECT_EQ(ecs.getComponent<Health>(entities[i]).value, i);
+    }
+    EXPECT_EQ(ecs.getComponent<Position>(entities[3]).x, 3.0f);
+}
+
+TEST_F(ArchetypeTest, ViewSelectsMatchingTables) {
+    for (int i = 0; i < 30; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        if (i % 3 == 0) ecs.addComponent(entity, Health{i});
+    }
+
+    auto view = ecs.view<Position, Velocity>();
+    EXPECT_EQ(view.count(), 15u);
+
+    view.each([](Position& pos, const Velocity& vel) {
+        pos.x += vel.dx;
+    });
+
+    int tables = 0;
+    size_t matched = 0;
+    view.eachChunk([&](std::span<const vecs::Entity> entities, std::span<Position> positions, std::span<Velocity>) {
+        tables++;
+        matched += entities.size();
+        for (const auto& pos : positions) {
+            EXPECT_EQ(static_cast<int>(pos.x) % 2, 1);
+        }
+    });
+    EXPECT_EQ(tables, 2);
+    EXPECT_EQ(matched, 15u);
+
+    int withHealth = 0;
+    ecs.view<Health>().each([&withHealth](const vecs::Entity entity, const Health& health) {
+        EXPECT_EQ(static_cast<int>(entity.getId()), health.value);
+        withHealth++;
+    });
+    EXPECT_EQ(withHealth, 10);
+}
+
+TEST_F(ArchetypeTest, InvalidEntityThrows) {
+    const auto entity = ecs.createEntity();
+    ecs.destroyEntity(entity);
+
+    EXPECT_THROW(ecs.addComponent(entity, Position{0.0f, 0.0f}), std::runtime_error);
+    EXPECT_FALSE(ecs.hasComponent<Position>(entity));
+}
+
+struct Fragile {
+    explicit Fragile(const bool fail) {
+        if (fail) throw std::invalid_argument("Fragile construction failed");
+    }
+};
+
+TEST_F(ArchetypeTest, ThrowingConstructorLeavesRowInPlace) {
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Position{1.0f, 2.0f});
+    ecs.addComponent(entity, Velocity{3.0f, 4.0f});
+
+    EXPECT_THROW(ecs.emplaceComponent<Fragile>(entity, true), std::invalid_argument);
+    EXPECT_FALSE(ecs.hasComponent<Fragile>(entity));
+    EXPECT_EQ(ecs.getComponent<Position>(entity).y, 2.0f);
+    EXPECT_EQ(ecs.getComponent<Velocity>(entity).dx, 3.0f);
+    EXPECT_EQ((ecs.view<Position, Velocity>().count()), 1u);
+
+    ecs.emplaceComponent<Fragile>(entity, false);
+    EXPECT_TRUE(ecs.hasComponent<Fragile>(entity));
+    EXPECT_EQ(ecs.getComponent<Position>(entity).x, 1.0f);
+}
+
+struct Brittle {
+    static inline bool failMoves = false;
+    int value = 0;
+
+    explicit Brittle(const int v) : value(v) {}
+    // Copyable so that vector growth copies and only the row move can throw
+    Brittle(const Brittle&) = default;
+    Brittle& operator=(const Brittle&) = default;
+    Brittle(Brittle&& other) : value(other.value) {
+        if (failMoves) throw std::runtime_error("Brittle move failed");
+    }
+    Brittle& operator=(Brittle&&) = default;
+};
+
+TEST_F(ArchetypeTest, ThrowingMoveKeepsTargetColumnsAligned) {
+    const auto first = ecs.createEntity();
+    ecs.addComponent(first, Position{1.0f, 0.0f});
+    ecs.emplaceComponent<Brittle>(first, 1);
+
+    const auto second = ecs.createEntity();
+    ecs.addComponent(second, Position{2.0f, 0.0f});
+    ecs.emplaceComponent<Brittle>(second, 2);
+    ecs.addComponent(second, Velocity{2.0f, 0.0f});
+
+    Brittle::failMoves = true;
+    EXPECT_THROW(ecs.addComponent(first, Velocity{1.0f, 0.0f}), std::runtime_error);
+    Brittle::failMoves = false;
+    EXPECT_FALSE(ecs.hasComponent<Velocity>(first));
+    EXPECT_TRUE(ecs.hasComponent<Brittle>(first));
+
+    // The target table holds only its complete row, so its columns still line up
+    size_t rows = 0;
+    ecs.view<Position, Brittle, Velocity>().each([&rows](const vecs::Entity, const Position& position, const Brittle& brittle, const Velocity& velocity) {
+        EXPECT_EQ(position.x, 2.0f);
+        EXPECT_EQ(brittle.value, 2);
+        EXPECT_EQ(velocity.dx, 2.0f);
+        rows++;
+    });
+    EXPECT_EQ(rows, 1u);
+
+    const auto third = ecs.createEntity();
+    ecs.addComponent(third, Position{3.0f, 0.0f});
+    ecs.emplaceComponent<Brittle>(third, 3);
+    ecs.addComponent(third, Velocity{3.0f, 0.0f});
+    EXPECT_EQ(ecs.getComponent<Brittle>(third).value, 3);
+    EXPECT_EQ(ecs.getComponent<Velocity>(third).dx, 3.0f);
+    EXPECT_EQ(ecs.getComponent<Position>(second).x, 2.0f);
+    EXPECT_EQ(ecs.getComponent<Brittle>(second).value, 2);
+}
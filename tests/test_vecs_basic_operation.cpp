@@ -30,6 +30,16 @@ struct Health {
     }
 };
 
+struct UnitConfig {
+    int level = 0;
+    char name[64]{};
+};
+
+struct Unit {
+    float health;
+    using Cold = UnitConfig;
+};
+
 class ECSTest : public testing::Test {
 protected:
     vecs::ECS ecs;
@@ -236,4 +246,370 @@ TEST_F(ECSTest, VersionWrapsAround) {
     const auto finalVersion = entity.getVersion();
     EXPECT_LE(finalVersion, vecs::EntityConstants::versionMask)
         << "Version should wrap around within mask limits";
-}
\ No newline at end of file
+}
+
+TEST_F(ECSTest, SplitComponentKeepsColdPartAligned) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 6; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Unit{static_cast<float>(i)});
+        ecs.getColdComponent<Unit>(entity).level = i;
+        entities.push_back(entity);
+    }
+
+    ecs.removeComponent<Unit>(entities[1]);
+    ecs.destroyEntity(entities[3]);
+    EXPECT_THROW(static_cast<void>(ecs.getColdComponent<Unit>(entities[1])), std::runtime_error);
+
+    const auto* pool = ecs.getComponentPool<Unit>();
+    ASSERT_EQ(pool->getColdComponents().size(), pool->size());
+    for (const int i : {0, 2, 4, 5}) {
+        EXPECT_EQ(ecs.getColdComponent<Unit>(entities[i]).level, i);
+        EXPECT_EQ(ecs.getComponent<Unit>(entities[i]).health, static_cast<float>(i));
+    }
+
+    auto& group = ecs.group<Unit, Health>();
+    ecs.addComponent(entities[5], Health{5});
+    EXPECT_EQ(group.size(), 1u);
+    EXPECT_EQ(ecs.getColdComponent<Unit>(entities[5]).level, 5);
+    EXPECT_EQ(ecs.getColdComponent<Unit>(entities[0]).level, 0);
+}
+
+enum class LifecyclePhase { Spawning, Active, Dying, Count };
+
+TEST_F(ECSTest, StateComponentsStayPartitionedByValue) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 30; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.setState(entity, static_cast<LifecyclePhase>(i % 3));
+        entities.push_back(entity);
+    }
+
+    auto expectPartitioned = [this] {
+        for (const auto phase : {LifecyclePhase::Spawning, LifecyclePhase::Active, LifecyclePhase::Dying}) {
+            for (const auto entity : ecs.entitiesInState(phase)) {
+                EXPECT_EQ(ecs.getState<LifecyclePhase>(entity), phase);
+            }
+        }
+    };
+
+    expectPartitioned();
+    EXPECT_EQ(ecs.entitiesInState(LifecyclePhase::Active).size(), 10u);
+
+    ecs.setState(entities[0], LifecyclePhase::Dying);
+    ecs.setState(entities[2], LifecyclePhase::Spawning);
+    ecs.setState(entities[4], LifecyclePhase::Active);
+    expectPartitioned();
+    EXPECT_EQ(ecs.entitiesInState(LifecyclePhase::Spawning).size(), 10u);
+    EXPECT_EQ(ecs.entitiesInState(LifecyclePhase::Dying).size(), 10u);
+
+    ecs.removeState<LifecyclePhase>(entities[3]);
+    ecs.destroyEntity(entities[1]);
+    EXPECT_FALSE(ecs.hasState<LifecyclePhase>(entities[3]));
+    EXPECT_THROW((void)ecs.getState<LifecyclePhase>(entities[3]), std::runtime_error);
+    expectPartitioned();
+
+    int visited = 0;
+    ecs.eachInState(LifecyclePhase::Spawning, [&visited](vecs::Entity) { visited++; });
+    EXPECT_EQ(visited, 9);
+    EXPECT_EQ(ecs.entitiesInState(LifecyclePhase::Active).size(), 9u);
+
+    // Values outside the enum's range are rejected without touching the partitions
+    EXPECT_THROW(ecs.setState(entities[4], LifecyclePhase::Count), std::runtime_error);
+    EXPECT_THROW(ecs.setState(ecs.createEntity(), static_cast<LifecyclePhase>(7)), std::runtime_error);
+    EXPECT_EQ(ecs.getState<LifecyclePhase>(entities[4]), LifecyclePhase::Active);
+    expectPartitioned();
+}
+
+TEST_F(ECSTest, OutOfRangeStatesHaveNoEntities) {
+    for (int i = 0; i < 6; ++i) {
+        ecs.setState(ecs.createEntity(), static_cast<LifecyclePhase>(i % 3));
+    }
+
+    EXPECT_TRUE(ecs.entitiesInState(LifecyclePhase::Count).empty());
+    EXPECT_TRUE(ecs.entitiesInState(static_cast<LifecyclePhase>(200)).empty());
+
+    int visited = 0;
+    ecs.eachInState(static_cast<LifecyclePhase>(7), [&visited](vecs::Entity) { visited++; });
+    EXPECT_EQ(visited, 0);
+
+    vecs::StatePool<LifecyclePhase> pool;
+    pool.insert(vecs::Entity{0}, LifecyclePhase::Dying);
+    EXPECT_EQ(pool.size(LifecyclePhase::Dying), 1u);
+    EXPECT_EQ(pool.size(LifecyclePhase::Count), 0u);
+    EXPECT_TRUE(pool.entities(LifecyclePhase::Count).empty());
+}
+
+TEST_F(ECSTest, DisabledEntitiesKeepComponentsButLeaveViews) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        ecs.addComponent(entity, Unit{static_cast<float>(i)});
+        ecs.getColdComponent<Unit>(entity).level = i;
+        entities.push_back(entity);
+    }
+
+    for (const int i : {1, 4, 7}) {
+        ecs.disable(entities[i]);
+    }
+    EXPECT_FALSE(ecs.isEnabled(entities[4]));
+    EXPECT_EQ(ecs.disabledCount(), 3u);
+    EXPECT_TRUE(ecs.hasComponent<Position>(entities[4]));
+    EXPECT_EQ(ecs.getComponent<Position>(entities[4]).x, 4.0f);
+
+    int visited = 0;
+    ecs.view<Position, Unit>().each([&visited](const Position& pos, const Unit& unit) {
+        EXPECT_EQ(pos.x, unit.health);
+        EXPECT_NE(static_cast<int>(pos.x) % 3, 1);
+        visited++;
+    });
+    EXPECT_EQ(visited, 7);
+    EXPECT_EQ(ecs.view<Position>().count(), 7u);
+
+    // Components added to or removed from disabled entities keep the partition intact
+    ecs.addComponent(entities[4], Health{4});
+    ecs.removeComponent<Unit>(entities[7]);
+    ecs.removeComponent<Unit>(entities[2]);
+    EXPECT_EQ(ecs.view<Health>().count(), 0u);
+    for (const int i : {0, 1, 3, 4, 5, 6, 8, 9}) {
+        EXPECT_EQ(ecs.getColdComponent<Unit>(entities[i]).level, i);
+        EXPECT_EQ(ecs.getComponent<Unit>(entities[i]).health, static_cast<float>(i));
+    }
+
+    ecs.enable(entities[4]);
+    ecs.enable(entities[7]);
+    EXPECT_EQ(ecs.view<Health>().count(), 1u);
+    EXPECT_EQ(ecs.view<Position>().count(), 9u);
+    EXPECT_EQ((ecs.view<Position, Unit>().count()), 7u);
+    EXPECT_EQ(ecs.getColdComponent<Unit>(entities[4]).level, 4);
+
+    EXPECT_THROW((void)ecs.group<Position>(), std::runtime_error);
+    ecs.destroyEntity(entities[1]);
+    EXPECT_EQ(ecs.disabledCount(), 0u);
+    EXPECT_NO_THROW((void)ecs.group<Position>());
+    EXPECT_THROW(ecs.disable(entities[0]), std::runtime_error);
+}
+
+TEST_F(ECSTest, ShrinkReleasesPeakCapacity) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 20000; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        entities.push_back(entity);
+    }
+    for (size_t i = 10; i < entities.size(); ++i) {
+        ecs.destroyEntity(entities[i]);
+    }
+    ecs.destroyEntity(entities[5]);
+
+    const auto& sparseSet = ecs.getComponentPool<Position>()->getSparseSet();
+    EXPECT_GE(sparseSet.capacity(), 20000u);
+
+    ecs.shrink(true);
+    EXPECT_EQ(sparseSet.capacity(), 9u);
+    EXPECT_EQ(sparseSet.sparseSize(), 10u);
+    EXPECT_LT(ecs.getEntityCapacity(), 20000u);
+    EXPECT_EQ(ecs.size(), 9u);
+
+    for (const int i : {0, 4, 6, 9}) {
+        EXPECT_TRUE(ecs.isValid(entities[i]));
+        EXPECT_EQ(ecs.getComponent<Position>(entities[i]).x, static_cast<float>(i));
+    }
+    EXPECT_EQ(ecs.view<Position>().count(), 9u);
+
+    // The recycled ID below the highest live one is reused, then IDs continue after it
+    EXPECT_EQ(ecs.createEntity().getId(), 5u);
+    const auto entity = ecs.createEntity();
+    EXPECT_EQ(entity.getId(), 10u);
+    ecs.addComponent(entity, Position{1.0f, 2.0f});
+    EXPECT_EQ(ecs.getComponent<Position>(entity).y, 2.0f);
+}
+
+TEST_F(ECSTest, CompactIdsRenumbersLiveEntities) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) ecs.addComponent(entity, Velocity{static_cast<float>(i), 0.0f});
+        entities.push_back(entity);
+    }
+    auto& query = ecs.query<Position, Velocity>();
+    for (size_t i = 0; i < entities.size(); ++i) {
+        if (i % 10 != 0) ecs.destroyEntity(entities[i]);
+    }
+    ecs.disable(entities[30]);
+
+    const auto remap = ecs.compactIds();
+    ASSERT_EQ(remap.size(), 100u);
+    EXPECT_EQ(remap[1], vecs::Entity::null());
+
+    for (size_t i = 0; i < entities.size(); i += 10) {
+        const auto entity = remap[entities[i].getId()];
+        EXPECT_EQ(entity.getId(), i / 10);
+        EXPECT_TRUE(ecs.isValid(entity));
+        EXPECT_EQ(ecs.getComponent<Position>(entity).x, static_cast<float>(i));
+        EXPECT_EQ(ecs.getComponent<Velocity>(entity).dx, static_cast<float>(i));
+        if (i != 0) {
+            EXPECT_FALSE(ecs.isValid(entities[i]));
+        }
+    }
+    EXPECT_TRUE(ecs.isValid(entities[0]));
+    EXPECT_FALSE(ecs.isEnabled(remap[entities[30].getId()]));
+    EXPECT_EQ((ecs.view<Position, Velocity>().count()), 9u);
+    EXPECT_EQ(query.size(), 9u);
+    EXPECT_TRUE(query.contains(remap[entities[90].getId()]));
+    EXPECT_FALSE(query.contains(remap[entities[30].getId()]));
+
+    // New entities continue right after the compacted range
+    EXPECT_EQ(ecs.createEntity().getId(), 10u);
+}
+
+TEST_F(ECSTest, ShrinkAfterCompactKeepsStaleHandlesInvalid) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 4; ++i) {
+        entities.push_back(ecs.createEntity());
+    }
+    ecs.destroyEntity(entities[0]);
+
+    ecs.compactIds();
+    ecs.shrink();
+
+    const auto entity = ecs.createEntity();
+    EXPECT_EQ(entity.getId(), entities[3].getId());
+    EXPECT_TRUE(ecs.isValid(entity));
+    EXPECT_FALSE(ecs.isValid(entities[3]));
+}
+
+TEST_F(ECSTest, DefragmentRestoresEntityOrder) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 1000; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(entity.getId()), 0.0f});
+        ecs.addComponent(entity, Velocity{static_cast<float>(entity.getId()), 0.0f});
+        entities.push_back(entity);
+    }
+    for (size_t i = 0; i < entities.size(); i += 3) {
+        ecs.destroyEntity(entities[i]);
+    }
+    ecs.disable(entities[500]);
+    ecs.disable(entities[100]);
+
+    const auto& positions = ecs.getComponentPool<Position>()->getSparseSet();
+    const auto& velocities = ecs.getComponentPool<Velocity>()->getSparseSet();
+    EXPECT_FALSE(positions.isEntitySorted());
+
+    // Every call stays within its budget and the pools get back in order over several calls
+    size_t calls = 0;
+    while (const auto visited = ecs.defragment(64)) {
+        EXPECT_LE(visited, 64u);
+        ++calls;
+    }
+    EXPECT_GT(calls, 1u);
+
+    const auto expectPartitionsSorted = [](const auto& sparseSet) {
+        const auto& dense = sparseSet.getEntities();
+        const auto active = dense.begin() + static_cast<std::ptrdiff_t>(sparseSet.activeSize());
+        EXPECT_TRUE(std::ranges::is_sorted(dense.begin(), active, {}, &vecs::Entity::getId));
+        EXPECT_TRUE(std::ranges::is_sorted(active, dense.end(), {}, &vecs::Entity::getId));
+    };
+    expectPartitionsSorted(positions);
+    expectPartitionsSorted(velocities);
+    EXPECT_EQ(velocities.size(), 666u);
+
+    ecs.view<Position, Velocity>().each([](const vecs::Entity entity, const Position& position, const Velocity& velocity) {
+        EXPECT_EQ(position.x, static_cast<float>(entity.getId()));
+        EXPECT_EQ(velocity.dx, static_cast<float>(entity.getId()));
+    });
+
+    // A full radix sort does the same in one go
+    ecs.enable(entities[500]);
+    ecs.enable(entities[100]);
+    ecs.destroyEntity(entities[1]);
+    ecs.destroyEntity(entities[2]);
+    EXPECT_FALSE(velocities.isEntitySorted());
+    ecs.sortByEntity<Velocity>();
+    EXPECT_TRUE(velocities.isEntitySorted());
+    EXPECT_EQ(ecs.getComponent<Velocity>(entities[4]).dx, static_cast<float>(entities[4].getId()));
+}
+
+TEST_F(ECSTest, MemoryStatsReportPoolsAndEntities) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 1000; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 10 == 0) ecs.addComponent(entity, Velocity{0.0f, 0.0f});
+        entities.push_back(entity);
+    }
+    for (int i = 0; i < 200; ++i) {
+        ecs.destroyEntity(entities[i]);
+    }
+
+    const auto positions = ecs.memoryStats<Position>();
+    EXPECT_EQ(positions.size, 800u);
+    EXPECT_GE(positions.capacity, 800u);
+    EXPECT_GE(positions.componentBytes, 800 * sizeof(Position));
+    EXPECT_GE(positions.denseBytes, 800 * sizeof(vecs::Entity));
+    EXPECT_EQ(positions.emptySparseSlots, positions.sparseSlots - 800);
+    EXPECT_GT(positions.loadFactor(), 0.0);
+    EXPECT_LE(positions.loadFactor(), 1.0);
+    EXPECT_EQ(ecs.memoryStats<Velocity>().size, 80u);
+    EXPECT_EQ(ecs.memoryStats<Health>().totalBytes(), 0u);
+
+    const auto world = ecs.memoryStats();
+    EXPECT_EQ(world.poolCount, 2u);
+    EXPECT_EQ(world.pools.size, 880u);
+    EXPECT_EQ(world.entities.size, 800u);
+    EXPECT_EQ(world.entities.recycled, 200u);
+    EXPECT_GE(world.entities.versionBytes, 1000 * sizeof(vecs::Version));
+    EXPECT_EQ(world.totalBytes(), world.pools.totalBytes() + world.entities.totalBytes());
+
+    // Shrinking shows up as released capacity
+    ecs.shrink();
+    EXPECT_LT(ecs.memoryStats<Position>().totalBytes(), positions.totalBytes());
+    EXPECT_EQ(ecs.memoryStats<Position>().capacity, 800u);
+}
+
+TEST(WorldConfigTest, MinimalWorldAllocatesOnDemand) {
+    vecs::ECS world{vecs::WorldConfig::minimal()};
+    EXPECT_EQ(world.memoryStats().totalBytes(), 0u);
+
+    const auto first = world.createEntity();
+    world.addComponent(first, Position{1.0f, 2.0f});
+    world.addComponent(first, Velocity{3.0f, 4.0f});
+    const auto stats = world.memoryStats();
+    EXPECT_EQ(stats.poolCount, 2u);
+    EXPECT_LE(stats.pools.capacity, 4u);
+    EXPECT_LT(stats.totalBytes(), 1024u);
+
+    // Pools grow with their contents and behave like in a default world
+    std::vector<vecs::Entity> entities{first};
+    for (int i = 1; i < 10000; ++i) {
+        const auto entity = world.createEntity();
+        world.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) world.addComponent(entity, Velocity{static_cast<float>(i), 0.0f});
+        entities.push_back(entity);
+    }
+    EXPECT_EQ((world.view<Position, Velocity>().count()), 5000u);
+    EXPECT_EQ(world.getComponent<Position>(entities[9999]).x, 9999.0f);
+    EXPECT_EQ(world.getComponent<Velocity>(first).dy, 4.0f);
+
+    world.destroyEntity(first);
+    EXPECT_EQ(world.createEntity().getId(), first.getId());
+
+    vecs::ECS defaultWorld;
+    defaultWorld.addComponent(defaultWorld.createEntity(), Position{});
+    EXPECT_GT(defaultWorld.memoryStats().totalBytes(), 100 * stats.totalBytes());
+}
+
+TEST(WorldConfigTest, SmallCapacitiesAreHonoured) {
+    vecs::ECS world{vecs::WorldConfig{.entityCapacity = 64, .poolCapacity = 64}};
+    EXPECT_EQ(world.getEntityCapacity(), 64u);
+
+    world.addComponent(world.createEntity(), Position{});
+    EXPECT_EQ(world.memoryStats<Position>().capacity, 64u);
+    EXPECT_EQ(world.memoryStats().entities.versionBytes, 64 * sizeof(vecs::Version));
+
+    const vecs::ECS defaults;
+    EXPECT_EQ(defaults.getEntityCapacity(), vecs::WorldConfig{}.entityCapacity);
+}
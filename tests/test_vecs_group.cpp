@@ -0,0 +1,377 @@
+//
+// Created by Vyxs on 16/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include "../src/vecs/ECS.h"
+
+struct Position {
+    float x, y;
+    bool operator==(const Position& other) const {
+        return x == other.x && y == other.y;
+    }
+};
+
+struct Velocity {
+    float dx, dy;
+    bool operator==(const Velocity& other) const {
+        return dx == other.dx && dy == other.dy;
+    }
+};
+
+struct Health {
+    int value;
+    bool operator==(const Health& other) const {
+        return value == other.value;
+    }
+};
+
+class GroupTest : public testing::Test {
+protected:
+    vecs::ECS ecs;
+
+    void SetUp() override {
+        ecs.clear();
+    }
+
+    // The first group.size() slots of both pools must hold the same entities in the same order
+    void expectPacked(const vecs::Group<Position, Velocity>& group) const {
+        const auto& positions = ecs.getComponentPool<Position>()->getEntities();
+        const auto& velocities = ecs.getComponentPool<Velocity>()->getEntities();
+        ASSERT_GE(positions.size(), group.size());
+        ASSERT_GE(velocities.size(), group.size());
+        for (size_t i = 0; i < group.size(); ++i) {
+            EXPECT_EQ(positions[i], velocities[i]) << "Dense slot " << i << " differs between pools";
+        }
+        for (size_t i = group.size(); i < positions.size(); ++i) {
+            EXPECT_FALSE(ecs.hasComponent<Velocity>(positions[i])) << "Matching entity left outside the group";
+        }
+    }
+};
+
+TEST_F(GroupTest, GroupPacksExistingEntities) {
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 3 == 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        }
+    }
+
+    const auto& group = ecs.group<Position, Velocity>();
+    EXPECT_EQ(group.size(), 4);
+    expectPacked(group);
+}
+
+TEST_F(GroupTest, GroupTracksAddedComponents) {
+    auto& group = ecs.group<Position, Velocity>();
+    EXPECT_TRUE(group.empty());
+
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        entities.push_back(entity);
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+    }
+    for (int i = 9; i >= 0; i -= 2) {
+        ecs.emplaceComponent<Velocity>(entities[i], 1.0f, 2.0f);
+    }
+
+    EXPECT_EQ(group.size(), 5);
+    expectPacked(group);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(group.contains(entities[i]), i % 2 == 1);
+    }
+}
+
+TEST_F(GroupTest, GroupTracksRemovedComponentsAndEntities) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        entities.push_back(entity);
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+    }
+
+    auto& group = ecs.group<Position, Velocity>();
+    EXPECT_EQ(group.size(), 10);
+
+    ecs.removeComponent<Velocity>(entities[2]);
+    ecs.removeComponent<Position>(entities[5]);
+    ecs.destroyEntity(entities[7]);
+
+    EXPECT_EQ(group.size(), 7);
+    EXPECT_FALSE(group.contains(entities[2]));
+    EXPECT_FALSE(group.contains(entities[5]));
+    EXPECT_FALSE(group.contains(entities[7]));
+    expectPacked(group);
+
+    ecs.addComponent(entities[2], Velocity{2.0f, 0.0f});
+    EXPECT_EQ(group.size(), 8);
+    EXPECT_TRUE(group.contains(entities[2]));
+    expectPacked(group);
+}
+
+TEST_F(GroupTest, GroupEachWalksPackedComponents) {
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 2.0f});
+        }
+    }
+
+    auto& group = ecs.group<Position, Velocity>();
+    int count = 0;
+    group.each([&count](Position& pos, const Velocity& vel) {
+        pos.y += vel.dy;
+        count++;
+    });
+    EXPECT_EQ(count, 50);
+
+    group.each([this](const vecs::Entity entity, const Position& pos, const Velocity&) {
+        EXPECT_EQ(pos.y, 2.0f);
+        EXPECT_EQ(ecs.getComponent<Position>(entity).x, static_cast<float>(entity.getId()));
+    });
+}
+
+TEST_F(GroupTest, GroupEachChunkSpansPackedRange) {
+    for (int i = 0; i < 20; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{0.0f, 0.0f});
+        if (i < 15) {
+            ecs.addComponent(entity, Velocity{1.0f, 1.0f});
+        }
+    }
+
+    auto& group = ecs.group<Position, Velocity>();
+    int calls = 0;
+    group.eachChunk([&calls](std::span<const vecs::Entity> entities,
+                             std::span<Position> positions,
+                             std::span<Velocity> velocities) {
+        EXPECT_EQ(entities.size(), 15);
+        EXPECT_EQ(positions.size(), 15);
+        EXPECT_EQ(velocities.size(), 15);
+        calls++;
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(GroupTest, GroupIsSharedAndExclusive) {
+    auto& first = ecs.group<Position, Velocity>();
+    auto& second = ecs.group<Position, Velocity>();
+    EXPECT_EQ(&first, &second);
+
+    const auto action = [this]() {
+        const auto& group = ecs.group<Position, Health>();
+        (void)group;
+    };
+    EXPECT_THROW(action(), std::runtime_error) << "Position is already owned by another group";
+}
+
+TEST_F(GroupTest, DisabledEntitiesCannotJoinOwnedPools) {
+    auto& group = ecs.group<Position, Velocity>();
+    const auto bystander = ecs.createEntity();
+    ecs.addComponent(bystander, Position{1.0f, 0.0f});
+
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Health{10});
+    ecs.disable(entity);
+
+    EXPECT_THROW(ecs.addComponent(entity, Position{2.0f, 0.0f}), std::runtime_error);
+    EXPECT_THROW(ecs.emplaceComponent<Velocity>(entity, 3.0f, 0.0f), std::runtime_error);
+    EXPECT_THROW(ecs.replaceComponent(entity, Position{2.0f, 0.0f}), std::runtime_error);
+    EXPECT_FALSE(ecs.hasComponent<Position>(entity));
+    EXPECT_EQ(group.size(), 0u);
+    EXPECT_EQ(ecs.view<Position>().count(), 1u);
+
+    ecs.enable(entity);
+    ecs.addComponent(entity, Position{2.0f, 0.0f});
+    ecs.addComponent(entity, Velocity{3.0f, 0.0f});
+    EXPECT_EQ(group.size(), 1u);
+    EXPECT_TRUE(group.contains(entity));
+    EXPECT_EQ(ecs.view<Position>().count(), 2u);
+    expectPacked(group);
+}
+
+TEST_F(GroupTest, QueriesSkipDisabledEntities) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        entities.push_back(entity);
+    }
+    ecs.disable(entities[0]);
+
+    auto& query = ecs.query<Position, Velocity>();
+    EXPECT_EQ(query.size(), 4u);
+    EXPECT_FALSE(query.contains(entities[0]));
+
+    ecs.disable(entities[2]);
+    EXPECT_EQ(query.size(), 3u);
+    EXPECT_EQ(query.size(), (ecs.view<Position, Velocity>().count()));
+
+    // Components added while disabled stay out of the query until the entity is enabled
+    ecs.addComponent(entities[1], Velocity{1.0f, 0.0f});
+    ecs.disable(entities[3]);
+    ecs.addComponent(entities[3], Velocity{1.0f, 0.0f});
+    EXPECT_EQ(query.size(), 4u);
+    EXPECT_FALSE(query.contains(entities[3]));
+
+    ecs.enable(entities[0]);
+    ecs.enable(entities[3]);
+    EXPECT_EQ(query.size(), 6u);
+    EXPECT_TRUE(query.contains(entities[0]));
+    EXPECT_TRUE(query.contains(entities[3]));
+    EXPECT_EQ(query.size(), (ecs.view<Position, Velocity>().count()));
+
+    int visited = 0;
+    query.each([&visited](const Position&, const Velocity&) { visited++; });
+    EXPECT_EQ(visited, 6);
+}
+
+TEST_F(GroupTest, OwnedPoolsCannotBeReordered) {
+    const auto& group = ecs.group<Position, Velocity>();
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+    }
+
+    auto* positions = const_cast<vecs::Pool<Position>*>(ecs.getComponentPool<Position>());
+    EXPECT_THROW(positions->sort([](const Position& a, const Position& b) { return a.x > b.x; }), std::runtime_error);
+    EXPECT_THROW(positions->sortByEntity(), std::runtime_error);
+    EXPECT_THROW(ecs.sortByEntity<Velocity>(), std::runtime_error);
+    expectPacked(group);
+}
+
+TEST_F(GroupTest, ClearEmptiesGroup) {
+    auto& group = ecs.group<Position, Velocity>();
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Position{1.0f, 2.0f});
+    ecs.addComponent(entity, Velocity{3.0f, 4.0f});
+    EXPECT_EQ(group.size(), 1);
+
+    ecs.clear();
+    EXPECT_EQ(group.size(), 0);
+}
+
+TEST_F(GroupTest, PartialOwningGroupPacksOwnedComponentsOnly) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 12; ++i) {
+        const auto entity = ecs.createEntity();
+        entities.push_back(entity);
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        }
+    }
+
+    auto& group = ecs.group<Velocity>(vecs::get<Position>);
+    EXPECT_EQ(group.size(), 6);
+
+    ecs.addComponent(entities[1], Velocity{1.0f, 0.0f});
+    ecs.removeComponent<Position>(entities[0]);
+    EXPECT_EQ(group.size(), 6);
+    EXPECT_TRUE(group.contains(entities[1]));
+    EXPECT_FALSE(group.contains(entities[0]));
+
+    const auto& velocities = ecs.getComponentPool<Velocity>()->getEntities();
+    for (size_t i = 0; i < velocities.size(); ++i) {
+        EXPECT_EQ(i < group.size(), ecs.hasComponent<Position>(velocities[i]))
+            << "Owned pool must hold group members first";
+    }
+
+    int count = 0;
+    group.each([&count](const vecs::Entity entity, Velocity& vel, const Position& pos) {
+        EXPECT_EQ(pos.x, static_cast<float>(entity.getId()));
+        vel.dy = pos.x;
+        count++;
+    });
+    EXPECT_EQ(count, 6);
+}
+
+TEST_F(GroupTest, PartialOwningGroupsCanShareReferencedComponent) {
+    auto& movers = ecs.group<Velocity>(vecs::get<Position>);
+    auto& living = ecs.group<Health>(vecs::get<Position>);
+
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{0.0f, 0.0f});
+        if (i < 4) ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        if (i >= 7) ecs.addComponent(entity, Health{100});
+    }
+
+    EXPECT_EQ(movers.size(), 4);
+    EXPECT_EQ(living.size(), 3);
+}
+
+TEST_F(GroupTest, NonOwningGroupCachesMatchingEntities) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        entities.push_back(entity);
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        }
+    }
+
+    const auto& positionsBefore = ecs.getComponentPool<Position>()->getEntities();
+    const std::vector<vecs::Entity> orderBefore(positionsBefore.begin(), positionsBefore.end());
+
+    auto& group = ecs.group<>(vecs::get<Position, Velocity>);
+    EXPECT_EQ(group.size(), 5);
+    EXPECT_TRUE(std::ranges::equal(ecs.getComponentPool<Position>()->getEntities(), orderBefore))
+        << "Non-owning groups must not reorder pools";
+    EXPECT_EQ(ecs.getComponentPool<Position>()->getOwner(), nullptr);
+
+    ecs.destroyEntity(entities[0]);
+    ecs.addComponent(entities[1], Velocity{1.0f, 0.0f});
+    ecs.removeComponent<Velocity>(entities[4]);
+    EXPECT_EQ(group.size(), 4);
+    EXPECT_FALSE(group.contains(entities[0]));
+    EXPECT_TRUE(group.contains(entities[1]));
+    EXPECT_FALSE(group.contains(entities[4]));
+
+    int count = 0;
+    group.each([&count](const vecs::Entity entity, const Position& pos, const Velocity&) {
+        EXPECT_EQ(pos.x, static_cast<float>(entity.getId()));
+        count++;
+    });
+    EXPECT_EQ(count, 4);
+
+    // Owning the same pools afterwards is still allowed
+    const auto& owning = ecs.group<Position, Velocity>();
+    EXPECT_EQ(owning.size(), 4);
+}
+
+TEST_F(GroupTest, QueryIsMaintainedIncrementally) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 20; ++i) {
+        const auto entity = ecs.createEntity();
+        entities.push_back(entity);
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+    }
+    ecs.addComponent(entities[3], Health{3});
+
+    auto& query = ecs.query<Position, Health>();
+    EXPECT_EQ(&query, &ecs.group<>(vecs::get<Position, Health>));
+    EXPECT_EQ(query.size(), 1);
+
+    ecs.addComponent(entities[7], Health{7});
+    ecs.addComponent(entities[11], Health{11});
+    ecs.removeComponent<Position>(entities[3]);
+    EXPECT_EQ(query.size(), 2);
+
+    int count = 0;
+    query.each([&count](const Position& pos, const Health& health) {
+        EXPECT_EQ(pos.x, static_cast<float>(health.value));
+        count++;
+    });
+    EXPECT_EQ(count, 2);
+
+    ecs.clear();
+    EXPECT_TRUE(query.empty());
+}
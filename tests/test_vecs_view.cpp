@@ -3,6 +3,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <thread>
 #include "../src/vecs/ECS.h"
 #include "../src/vecs/View.h"
 
@@ -27,6 +28,29 @@ struct Health {
     }
 };
 
+// Only used by this file, so the ChunkBounds specialization cannot clash with other translation units
+struct SpatialPosition {
+    float x, y;
+};
+
+struct PositionRange {
+    float minX, maxX;
+};
+
+template<>
+struct vecs::ChunkBounds<SpatialPosition> {
+    using Type = PositionRange;
+
+    static Type compute(const std::span<const SpatialPosition> positions) {
+        PositionRange range{positions.front().x, positions.front().x};
+        for (const auto& pos : positions) {
+            range.minX = std::min(range.minX, pos.x);
+            range.maxX = std::max(range.maxX, pos.x);
+        }
+        return range;
+    }
+};
+
 class ViewTest : public testing::Test {
 protected:
     vecs::ECS ecs;
@@ -158,4 +182,723 @@ TEST_F(ViewTest, ViewPerformanceTest) {
     });
 
     EXPECT_EQ(count, entityCount / 2);
-}
\ No newline at end of file
+}
+
+TEST_F(ViewTest, EachChunkSingleComponentSpansWholePool) {
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+    }
+
+    int calls = 0;
+    const auto view = ecs.view<Position>();
+    view.eachChunk([&calls](std::span<const vecs::Entity> entities, std::span<Position> positions) {
+        EXPECT_EQ(entities.size(), 100);
+        EXPECT_EQ(positions.size(), 100);
+        for (auto& pos : positions) {
+            pos.y = pos.x * 2.0f;
+        }
+        calls++;
+    });
+
+    EXPECT_EQ(calls, 1);
+    view.each([](const Position& pos) {
+        EXPECT_EQ(pos.y, pos.x * 2.0f);
+    });
+}
+
+TEST_F(ViewTest, EachChunkJoinGathersBatchesAndWritesBack) {
+    constexpr int entityCount = 100;
+
+    for (int i = 0; i < entityCount; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 2.0f});
+        }
+    }
+
+    size_t total = 0;
+    const auto view = ecs.view<Position, Velocity>();
+    view.eachChunk<8>([&total](std::span<const vecs::Entity> entities,
+                               std::span<Position> positions,
+                               std::span<Velocity> velocities) {
+        EXPECT_LE(entities.size(), 8);
+        EXPECT_EQ(positions.size(), entities.size());
+        EXPECT_EQ(velocities.size(), entities.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            positions[i].x += velocities[i].dx;
+            positions[i].y += velocities[i].dy;
+        }
+        total += entities.size();
+    });
+
+    EXPECT_EQ(total, entityCount / 2);
+    view.each([](vecs::Entity entity, const Position& pos, const Velocity&) {
+        EXPECT_EQ(pos.x, static_cast<float>(entity.getId()) + 1.0f);
+        EXPECT_EQ(pos.y, 2.0f);
+    });
+}
+
+TEST_F(ViewTest, EachChunkOnEmptyViewDoesNotInvoke) {
+    int calls = 0;
+    ecs.view<Position>().eachChunk([&calls](std::span<const vecs::Entity>, std::span<Position>) {
+        calls++;
+    });
+    ecs.view<Position, Velocity>().eachChunk([&calls](std::span<const vecs::Entity>,
+                                                      std::span<Position>, std::span<Velocity>) {
+        calls++;
+    });
+
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(ViewTest, RangeForYieldsMatchingEntities) {
+    std::vector<vecs::Entity> expected;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 3 == 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 1.0f});
+            expected.push_back(entity);
+        }
+    }
+
+    const auto view = ecs.view<Position, Velocity>();
+    std::vector<vecs::Entity> visited;
+    for (const auto entity : view) {
+        visited.push_back(entity);
+        EXPECT_EQ(view.get<Position>(entity).x, static_cast<float>(entity.getId()));
+    }
+
+    const auto byValue = [](const vecs::Entity a, const vecs::Entity b) {
+        return a.getValue() < b.getValue();
+    };
+    std::ranges::sort(expected, byValue);
+    std::ranges::sort(visited, byValue);
+    EXPECT_EQ(visited, expected);
+}
+
+TEST_F(ViewTest, ViewWorksWithRangesAlgorithms) {
+    vecs::Entity target;
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        ecs.addComponent(entity, Velocity{static_cast<float>(i), 0.0f});
+        if (i == 7) target = entity;
+    }
+
+    const auto view = ecs.view<Position, Velocity>();
+    static_assert(std::forward_iterator<decltype(view.begin())>);
+
+    const auto it = std::ranges::find_if(view, [&view](const vecs::Entity entity) {
+        return view.get<Velocity>(entity).dx == 7.0f;
+    });
+    ASSERT_NE(it, view.end());
+    EXPECT_EQ(*it, target);
+    EXPECT_EQ(std::ranges::distance(view), 10);
+}
+
+TEST_F(ViewTest, ChunksCoverAllMatchesExactlyOnce) {
+    constexpr int entityCount = 1000;
+    for (int i = 0; i < entityCount; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{0.0f, 0.0f});
+        if (i % 2 == 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        }
+    }
+
+    const auto chunks = ecs.view<Position, Velocity>().chunks(64);
+    EXPECT_EQ(chunks.size(), (entityCount / 2 + 63) / 64);
+
+    std::for_each(chunks.begin(), chunks.end(), [](const auto& chunk) {
+        chunk.each([](Position& pos, const Velocity& vel) {
+            pos.x += vel.dx;
+        });
+    });
+
+    size_t matched = 0;
+    for (const auto& chunk : chunks) {
+        matched += static_cast<size_t>(std::ranges::distance(chunk));
+    }
+    EXPECT_EQ(matched, entityCount / 2);
+
+    ecs.view<Position, Velocity>().each([](const Position& pos, const Velocity&) {
+        EXPECT_EQ(pos.x, 1.0f);
+    });
+}
+
+TEST_F(ViewTest, PrefetchingViewVisitsSameEntities) {
+    constexpr int entityCount = 5000;
+    for (int i = 0; i < entityCount; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 3 != 0) {
+            ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        }
+    }
+
+    const auto view = ecs.view<Position, Velocity>();
+    EXPECT_EQ(view.getPrefetchDistance(), 0) << "Small pools should not be prefetched";
+
+    for (const size_t distance : {size_t{1}, size_t{2}, size_t{16}, size_t{10000}}) {
+        const auto prefetching = view.withPrefetchDistance(distance);
+        EXPECT_EQ(prefetching.getPrefetchDistance(), distance);
+
+        int count = 0;
+        float sum = 0.0f;
+        prefetching.each([&count, &sum](const Position& pos, const Velocity&) {
+            sum += pos.x;
+            count++;
+        });
+
+        float expectedSum = 0.0f;
+        view.each([&expectedSum](const Position& pos, const Velocity&) {
+            expectedSum += pos.x;
+        });
+
+        EXPECT_EQ(count, entityCount - (entityCount + 2) / 3);
+        EXPECT_EQ(sum, expectedSum);
+    }
+}
+
+TEST_F(ViewTest, ConstComponentViewIsReadOnly) {
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Position{1.0f, 2.0f});
+    ecs.addComponent(entity, Velocity{3.0f, 4.0f});
+
+    int count = 0;
+    const auto view = ecs.view<const Position, Velocity>();
+    static_assert(std::is_same_v<decltype(view.get<const Position>(entity)), const Position&>);
+    view.each([&count](const Position& pos, Velocity& vel) {
+        vel.dx = pos.x;
+        count++;
+    });
+
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(ecs.getComponent<Velocity>(entity).dx, 1.0f);
+    EXPECT_EQ(view.get<const Position>(entity).y, 2.0f);
+}
+
+TEST_F(ViewTest, ConstEcsViewDoesNotCreatePools) {
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Position{1.0f, 2.0f});
+
+    const vecs::ECS& reader = ecs;
+    int count = 0;
+    const auto view = reader.view<const Position, const Velocity>();
+    view.each([&count](const Position&, const Velocity&) {
+        count++;
+    });
+    for ([[maybe_unused]] const auto e : view) {
+        count++;
+    }
+    view.eachChunk([&count](std::span<const vecs::Entity>, std::span<const Position>, std::span<const Velocity>) {
+        count++;
+    });
+
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(ecs.getComponentPool<Velocity>(), nullptr) << "Const views must not create pools";
+
+    const auto positions = reader.view<const Position>();
+    positions.each([&count, entity](const vecs::Entity e, const Position& pos) {
+        EXPECT_EQ(e, entity);
+        EXPECT_EQ(pos.x, 1.0f);
+        count++;
+    });
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(ViewTest, OptionalComponentIsPassedAsPointer) {
+    const auto withVelocity = ecs.createEntity();
+    const auto withoutVelocity = ecs.createEntity();
+    ecs.addComponent(withVelocity, Position{1.0f, 0.0f});
+    ecs.addComponent(withVelocity, Velocity{2.0f, 0.0f});
+    ecs.addComponent(withoutVelocity, Position{3.0f, 0.0f});
+
+    int count = 0;
+    const auto view = ecs.view<Position, vecs::Optional<Velocity>>();
+    view.each([&](const vecs::Entity entity, Position& pos, Velocity* vel) {
+        if (entity == withVelocity) {
+            ASSERT_NE(vel, nullptr);
+            pos.x += vel->dx;
+        } else {
+            EXPECT_EQ(vel, nullptr);
+        }
+        count++;
+    });
+
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(ecs.getComponent<Position>(withVelocity).x, 3.0f);
+    EXPECT_EQ(ecs.getComponent<Position>(withoutVelocity).x, 3.0f);
+}
+
+TEST_F(ViewTest, OptionalComponentWithMissingPool) {
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Position{1.0f, 0.0f});
+
+    const vecs::ECS& reader = ecs;
+    int count = 0;
+    reader.view<const Position, vecs::Optional<const Health>>().each([&count](const Position&, const Health* health) {
+        EXPECT_EQ(health, nullptr);
+        count++;
+    });
+
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(ecs.getComponentPool<Health>(), nullptr);
+}
+
+TEST_F(ViewTest, OptionalComponentInChunks) {
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{0.0f, 0.0f});
+        ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        if (i % 2 == 0) {
+            ecs.addComponent(entity, Health{i});
+        }
+    }
+
+    int present = 0;
+    ecs.view<Position, Velocity, vecs::Optional<Health>>().eachChunk<4>(
+        [&present](std::span<const vecs::Entity> entities, std::span<Position> positions,
+                   std::span<Velocity>, std::span<Health*> healths) {
+            EXPECT_EQ(healths.size(), entities.size());
+            for (size_t i = 0; i < healths.size(); ++i) {
+                if (healths[i]) {
+                    EXPECT_EQ(healths[i]->value, static_cast<int>(entities[i].getId()));
+                    positions[i].x = 1.0f;
+                    present++;
+                }
+            }
+        });
+
+    EXPECT_EQ(present, 5);
+    ecs.view<Position, vecs::Optional<Health>>().each([](const Position& pos, const Health* health) {
+        EXPECT_EQ(pos.x, health ? 1.0f : 0.0f);
+    });
+}
+
+TEST_F(ViewTest, ProbesIndependentOfComponentOrder) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        if (i % 10 == 0) ecs.addComponent(entity, Health{i});
+        entities.push_back(entity);
+    }
+
+    auto collect = [](const auto& view) {
+        std::vector<vecs::Entity> matched;
+        for (const auto entity : view) {
+            matched.push_back(entity);
+        }
+        std::ranges::sort(matched, {}, &vecs::Entity::getId);
+        return matched;
+    };
+
+    const auto forward = collect(ecs.view<Health, Velocity, Position>());
+    const auto backward = collect(ecs.view<Position, Velocity, Health>());
+
+    ASSERT_EQ(forward.size(), 10u);
+    EXPECT_EQ(forward, backward);
+    for (size_t i = 0; i < forward.size(); ++i) {
+        EXPECT_EQ(forward[i], entities[i * 10]);
+    }
+
+    ecs.removeComponent<Velocity>(entities[0]);
+    int count = 0;
+    ecs.view<Position, Velocity, Health>().each([&count](const Position& pos, const Velocity&, const Health& health) {
+        EXPECT_EQ(pos.x, static_cast<float>(health.value));
+        count++;
+    });
+    EXPECT_EQ(count, 9);
+}
+
+TEST_F(ViewTest, MergeJoinOnEntitySortedPools) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 300; ++i) {
+        const auto entity = ecs.createEntity();
+        if (i % 2 == 0) ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 3 == 0) ecs.addComponent(entity, Velocity{static_cast<float>(i), 0.0f});
+        if (i % 5 == 0) ecs.addComponent(entity, Health{i});
+        entities.push_back(entity);
+    }
+
+    EXPECT_TRUE(ecs.getComponentPool<Position>()->isEntitySorted());
+    EXPECT_TRUE(ecs.getComponentPool<Velocity>()->isEntitySorted());
+    EXPECT_TRUE(ecs.getComponentPool<Health>()->isEntitySorted());
+
+    auto expectMatches = [this](const int expected) {
+        int count = 0;
+        ecs.view<Position, Velocity, Health>().each([&count](const Position& pos, const Velocity& vel, const Health& health) {
+            EXPECT_EQ(health.value % 30, 0);
+            EXPECT_EQ(pos.x, vel.dx);
+            count++;
+        });
+        EXPECT_EQ(count, expected);
+
+        int chunked = 0;
+        for (const auto& chunk : ecs.view<Position, Velocity, Health>().chunks(7)) {
+            chunk.each([&chunked](vecs::Entity) { chunked++; });
+        }
+        EXPECT_EQ(chunked, expected);
+    };
+
+    expectMatches(10);
+
+    ecs.removeComponent<Velocity>(entities[0]);
+    EXPECT_FALSE(ecs.getComponentPool<Velocity>()->isEntitySorted());
+    expectMatches(9);
+
+    ecs.removeComponent<Position>(entities[298]);
+    EXPECT_TRUE(ecs.getComponentPool<Position>()->isEntitySorted());
+}
+
+TEST_F(ViewTest, PresenceBitsetsIntersectAndCount) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 1000; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) ecs.addComponent(entity, Velocity{static_cast<float>(i), 0.0f});
+        entities.push_back(entity);
+    }
+
+    ecs.trackPresence<Position>();
+    ecs.trackPresence<Velocity>();
+    ecs.removeComponent<Position>(entities[0]);
+    ecs.removeComponent<Velocity>(entities[2]);
+    ecs.addComponent(entities[1], Velocity{1.0f, 0.0f});
+
+    const auto view = ecs.view<Position, Velocity>();
+    EXPECT_EQ(view.count(), 499u);
+
+    int count = 0;
+    view.each([&count](const vecs::Entity entity, const Position& pos, const Velocity& vel) {
+        EXPECT_EQ(pos.x, vel.dx);
+        EXPECT_NE(entity.getId(), 0u);
+        EXPECT_NE(entity.getId(), 2u);
+        count++;
+    });
+    EXPECT_EQ(count, 499);
+
+    size_t chunked = 0;
+    view.eachChunk([&chunked](std::span<const vecs::Entity> chunk, std::span<Position>, std::span<Velocity>) {
+        chunked += chunk.size();
+    });
+    EXPECT_EQ(chunked, 499u);
+
+    ecs.trackPresence<Velocity>(false);
+    EXPECT_EQ(view.count(), 499u);
+}
+
+TEST_F(ViewTest, RuntimeViewMatchesCompiledView) {
+    for (int i = 0; i < 50; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 3 == 0) ecs.addComponent(entity, Velocity{1.0f, 0.0f});
+        if (i % 2 == 0) ecs.addComponent(entity, Health{i});
+    }
+
+    const std::vector<std::type_index> types{typeid(Health), typeid(Position), typeid(Velocity)};
+    const auto runtime = ecs.runtimeView(types);
+
+    std::vector<vecs::Entity> expected;
+    for (const auto entity : ecs.view<Position, Velocity, Health>()) {
+        expected.push_back(entity);
+    }
+
+    std::vector<vecs::Entity> actual;
+    runtime.each([&actual](const vecs::Entity entity) { actual.push_back(entity); });
+
+    std::ranges::sort(expected, {}, &vecs::Entity::getId);
+    std::ranges::sort(actual, {}, &vecs::Entity::getId);
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(runtime.count(), 9u);
+    EXPECT_EQ(runtime.sizeHint(), 17u);
+    EXPECT_TRUE(runtime.contains(expected.front()));
+}
+
+TEST_F(ViewTest, RuntimeViewWithMissingPoolIsEmpty) {
+    const auto entity = ecs.createEntity();
+    ecs.addComponent(entity, Position{1.0f, 0.0f});
+
+    const std::vector<std::type_index> types{typeid(Position), typeid(Health)};
+    const auto runtime = ecs.runtimeView(types);
+
+    int count = 0;
+    runtime.each([&count](vecs::Entity) { count++; });
+    EXPECT_EQ(count, 0);
+    EXPECT_FALSE(runtime.contains(entity));
+
+    vecs::RuntimeView single;
+    single.iterate(ecs.getComponentPool(typeid(Position)));
+    EXPECT_EQ(single.count(), 1u);
+}
+
+TEST_F(ViewTest, StorageChunksSkipUnchangedData) {
+    constexpr size_t capacity = vecs::Pool<SpatialPosition>::chunkCapacity;
+    std::vector<vecs::Entity> entities;
+    for (size_t i = 0; i < capacity * 2 + 10; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, SpatialPosition{static_cast<float>(i), 0.0f});
+        entities.push_back(entity);
+    }
+
+    std::vector<size_t> sizes;
+    ecs.view<const SpatialPosition>().eachStorageChunk([&sizes, capacity](const vecs::StorageChunk<const SpatialPosition>& chunk) {
+        EXPECT_EQ(chunk.bounds.minX, chunk.components.front().x);
+        EXPECT_EQ(chunk.bounds.maxX, chunk.components.back().x);
+        EXPECT_EQ(chunk.entities.size(), chunk.components.size());
+        EXPECT_LE(chunk.size(), capacity);
+        sizes.push_back(chunk.size());
+    });
+    EXPECT_EQ(sizes, (std::vector<size_t>{capacity, capacity, 10}));
+
+    const auto seen = ecs.getTick();
+    ecs.advanceTick();
+    ecs.getComponent<SpatialPosition>(entities[capacity + 1]).x = -1.0f;
+    ecs.markChanged<SpatialPosition>(entities[capacity + 1]);
+
+    int visited = 0;
+    ecs.view<SpatialPosition>().eachStorageChunk([&visited, &seen](const vecs::StorageChunk<SpatialPosition>& chunk) {
+        EXPECT_GT(chunk.changeTick, seen);
+        EXPECT_EQ(chunk.bounds.minX, -1.0f);
+        visited++;
+    }, seen);
+    EXPECT_EQ(visited, 1);
+
+    // Const readers compute bounds of changed chunks themselves, without writing the pool
+    ecs.getComponent<SpatialPosition>(entities[0]).x = -2.0f;
+    ecs.markChanged<SpatialPosition>(entities[0]);
+    std::vector<std::thread> readers;
+    std::array<float, 4> minima{};
+    for (auto& minimum : minima) {
+        readers.emplace_back([this, &minimum]() {
+            ecs.view<const SpatialPosition>().eachStorageChunk([&minimum](const auto& chunk) {
+                minimum = std::min(minimum, chunk.bounds.minX);
+            });
+        });
+    }
+    for (auto& reader : readers) reader.join();
+    EXPECT_EQ(minima, (std::array<float, 4>{-2.0f, -2.0f, -2.0f, -2.0f}));
+
+    ecs.advanceTick();
+    const auto before = ecs.getTick() - 1;
+    ecs.destroyEntity(entities.back());
+    visited = 0;
+    ecs.view<const SpatialPosition>().eachStorageChunk([&visited](const auto& chunk) {
+        EXPECT_EQ(chunk.size(), 9u);
+        visited++;
+    }, before);
+    EXPECT_EQ(visited, 1);
+}
+
+struct Stamina {
+    int value;
+};
+
+template<>
+struct vecs::TrackChunks<Stamina> : std::true_type {};
+
+TEST_F(ViewTest, OnlyTrackedComponentsKeepChunkMetadata) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        ecs.addComponent(entity, Stamina{i});
+        entities.push_back(entity);
+    }
+    ecs.destroyEntity(entities[10]);
+
+    EXPECT_EQ(ecs.memoryStats<Position>().metadataBytes, 0u);
+    EXPECT_GT(ecs.memoryStats<Stamina>().metadataBytes, 0u);
+    static_assert(!vecs::ChunkTrackedComponent<Position>);
+
+    const auto seen = ecs.getTick();
+    ecs.advanceTick();
+    int visited = 0;
+    ecs.view<const Stamina>().eachStorageChunk([&visited](const auto&) { visited++; }, seen);
+    EXPECT_EQ(visited, 0);
+
+    ecs.markChanged<Stamina>(entities[0]);
+    ecs.markChanged<Position>(entities[0]);
+    ecs.view<const Stamina>().eachStorageChunk([&visited](const vecs::StorageChunk<const Stamina>& chunk) {
+        EXPECT_EQ(chunk.size(), 99u);
+        visited++;
+    }, seen);
+    EXPECT_EQ(visited, 1);
+}
+
+struct IsVisible {};
+
+TEST_F(ViewTest, FlagsFilterViews) {
+    ecs.trackPresence<Position>();
+
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 300; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 3 == 0) ecs.setFlag<IsVisible>(entity);
+        entities.push_back(entity);
+    }
+    const auto hidden = ecs.createEntity();
+    ecs.setFlag<IsVisible>(hidden);
+
+    EXPECT_TRUE(ecs.hasFlag<IsVisible>(entities[3]));
+    EXPECT_FALSE(ecs.hasFlag<IsVisible>(entities[4]));
+    EXPECT_FALSE(ecs.hasComponent<IsVisible>(entities[3]));
+    EXPECT_EQ(ecs.flagCount<IsVisible>(), 101u);
+
+    ecs.clearFlag<IsVisible>(entities[3]);
+    ecs.clearFlag<IsVisible>(entities[4]);
+    EXPECT_FALSE(ecs.hasFlag<IsVisible>(entities[3]));
+    EXPECT_EQ(ecs.flagCount<IsVisible>(), 100u);
+
+    auto view = ecs.view<Position, vecs::Flag<IsVisible>>();
+    int matched = 0;
+    view.each([&matched](const Position& pos, const IsVisible&) {
+        EXPECT_EQ(static_cast<int>(pos.x) % 3, 0);
+        EXPECT_NE(static_cast<int>(pos.x), 3);
+        matched++;
+    });
+    EXPECT_EQ(matched, 99);
+    EXPECT_EQ(view.count(), 99u);
+
+    std::vector<vecs::Entity> flagged;
+    ecs.eachFlagged<IsVisible>([&flagged](const vecs::Entity entity) {
+        flagged.push_back(entity);
+    });
+    EXPECT_EQ(flagged.size(), 100u);
+    EXPECT_EQ(flagged.back(), hidden);
+
+    ecs.destroyEntity(entities[0]);
+    EXPECT_EQ(ecs.flagCount<IsVisible>(), 99u);
+    EXPECT_FALSE(ecs.hasFlag<IsVisible>(ecs.createEntity()));
+
+    const std::vector<std::type_index> types{typeid(vecs::FlagPool<IsVisible>), typeid(Position)};
+    EXPECT_EQ(ecs.runtimeView(types).count(), 98u);
+}
+
+struct MeshRef {
+    int mesh;
+    bool operator==(const MeshRef&) const = default;
+};
+
+template<>
+struct std::hash<MeshRef> {
+    size_t operator()(const MeshRef& ref) const noexcept { return std::hash<int>{}(ref.mesh); }
+};
+
+TEST_F(ViewTest, SharedComponentsAreDeduplicated) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Position{static_cast<float>(i), 0.0f});
+        ecs.addSharedComponent(entity, MeshRef{i % 4});
+        entities.push_back(entity);
+    }
+
+    EXPECT_EQ(ecs.sharedValueCount<MeshRef>(), 4u);
+    EXPECT_EQ(&ecs.getSharedComponent<MeshRef>(entities[0]), &ecs.getSharedComponent<MeshRef>(entities[4]));
+    EXPECT_NE(&ecs.getSharedComponent<MeshRef>(entities[0]), &ecs.getSharedComponent<MeshRef>(entities[1]));
+
+    ecs.addSharedComponent(entities[1], MeshRef{7});
+    EXPECT_EQ(ecs.getSharedComponent<MeshRef>(entities[1]).mesh, 7);
+    EXPECT_EQ(ecs.sharedValueCount<MeshRef>(), 5u);
+
+    ecs.removeSharedComponent<MeshRef>(entities[1]);
+    EXPECT_FALSE(ecs.hasSharedComponent<MeshRef>(entities[1]));
+    EXPECT_EQ(ecs.sharedValueCount<MeshRef>(), 4u);
+    EXPECT_THROW((void)ecs.getSharedComponent<MeshRef>(entities[1]), std::runtime_error);
+
+    int matched = 0;
+    ecs.view<Position, vecs::Shared<MeshRef>>().each([&matched](const Position& pos, const MeshRef& ref) {
+        EXPECT_EQ(static_cast<int>(pos.x) % 4, ref.mesh);
+        matched++;
+    });
+    EXPECT_EQ(matched, 99);
+
+    for (size_t i = 0; i < entities.size(); i += 4) {
+        ecs.destroyEntity(entities[i]);
+    }
+    EXPECT_EQ(ecs.sharedValueCount<MeshRef>(), 3u);
+    EXPECT_EQ((ecs.view<Position, vecs::Shared<MeshRef>>().count()), 74u);
+}
+
+struct TextureHandle {
+    std::shared_ptr<int> texture;
+    bool operator==(const TextureHandle&) const = default;
+};
+
+template<>
+struct std::hash<TextureHandle> {
+    size_t operator()(const TextureHandle& handle) const noexcept { return std::hash<std::shared_ptr<int>>{}(handle.texture); }
+};
+
+TEST_F(ViewTest, SharedValuesAreDestroyedWithTheirLastEntity) {
+    auto texture = std::make_shared<int>(42);
+    const auto first = ecs.createEntity();
+    const auto second = ecs.createEntity();
+    ecs.addSharedComponent(first, TextureHandle{texture});
+    ecs.addSharedComponent(second, TextureHandle{texture});
+    EXPECT_EQ(texture.use_count(), 2);
+
+    ecs.destroyEntity(first);
+    EXPECT_EQ(texture.use_count(), 2);
+    ecs.removeSharedComponent<TextureHandle>(second);
+    EXPECT_EQ(texture.use_count(), 1);
+    EXPECT_EQ(ecs.sharedValueCount<TextureHandle>(), 0u);
+}
+
+struct MoverPosition { float x, y; };
+struct MoverVelocity { float dx, dy; };
+using Mover = vecs::Fused<MoverPosition, MoverVelocity>;
+
+template<>
+struct vecs::FusedStorage<MoverPosition> { using Type = Mover; };
+
+template<>
+struct vecs::FusedStorage<MoverVelocity> { using Type = Mover; };
+
+TEST_F(ViewTest, FusedComponentsShareOnePool) {
+    std::vector<vecs::Entity> entities;
+    for (int i = 0; i < 200; ++i) {
+        const auto entity = ecs.createEntity();
+        ecs.addComponent(entity, Mover{MoverPosition{static_cast<float>(i), 0.0f}, MoverVelocity{1.0f, 2.0f}});
+        if (i % 2 == 0) ecs.addComponent(entity, Health{i});
+        entities.push_back(entity);
+    }
+
+    EXPECT_TRUE(ecs.hasComponent<MoverVelocity>(entities[3]));
+    EXPECT_EQ(ecs.getComponent<MoverPosition>(entities[3]).x, 3.0f);
+
+    auto movers = ecs.view<MoverPosition, const MoverVelocity>();
+    EXPECT_EQ(movers.count(), 200u);
+    movers.each([](MoverPosition& pos, const MoverVelocity& vel) {
+        pos.x += vel.dx;
+        pos.y += vel.dy;
+    });
+    EXPECT_EQ(ecs.getComponent<MoverPosition>(entities[3]).x, 4.0f);
+    EXPECT_EQ(ecs.getComponent<MoverPosition>(entities[3]).y, 2.0f);
+
+    movers.eachChunk([](std::span<const vecs::Entity>, std::span<MoverPosition> positions,
+                        std::span<const MoverVelocity>) {
+        for (auto& pos : positions) pos.y = -1.0f;
+    });
+    EXPECT_EQ(ecs.getComponent<MoverPosition>(entities[10]).y, -1.0f);
+
+    int matched = 0;
+    ecs.view<Health, MoverVelocity, MoverPosition>().each([&matched](const Health& health, MoverVelocity&, const MoverPosition& pos) {
+        EXPECT_EQ(health.value % 2, 0);
+        EXPECT_EQ(static_cast<float>(health.value) + 1.0f, pos.x);
+        matched++;
+    });
+    EXPECT_EQ(matched, 100);
+    EXPECT_EQ((ecs.view<Health, MoverVelocity, MoverPosition>().count()), 100u);
+
+    ecs.removeComponent<Mover>(entities[0]);
+    EXPECT_FALSE(ecs.hasComponent<MoverPosition>(entities[0]));
+    EXPECT_EQ(std::ranges::distance(ecs.view<MoverPosition, MoverVelocity>()), 199);
+}